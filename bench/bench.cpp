@@ -0,0 +1,403 @@
+//******************************************************************************
+//File Name: bench.cpp
+//Description: Microbenchmarks for loading, indexing, searching, modifying and
+//             rendering employees.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "datasetGenerator.hpp"
+#include "employeeDatabase.hpp"
+#include "employeeLoader.hpp"
+#include "employeeStore.hpp"
+#include "employees.hpp"
+#include "mappedFile.hpp"
+#include "roles.hpp"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <print>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+struct BenchOptions
+{
+    std::uint64_t rows{ 1'000'000 };        // Rows generated when no database is given.
+    std::uint64_t operations{ 1'000'000 };  // Operations per lookup and modification benchmark.
+    std::uint64_t seed{ 1 };
+    std::filesystem::path database;         // Empty generates one.
+    std::string_view filter;                // Only benchmarks whose names contain this run.
+};
+
+[[noreturn]]
+void usage(std::string_view program)
+{
+    std::println("Usage: {} [--database=<path>|--rows=<count>] [--operations=<count>] [--seed=<number>]"
+                 " [--filter=<text>]", program);
+    std::exit(1);
+}
+
+std::uint64_t parseCount(std::string_view text, std::string_view program)
+{
+    std::uint64_t count{};
+    auto [end, error]{ std::from_chars(text.data(), text.data() + text.size(), count) };
+
+    if (error != std::errc{} || end != text.data() + text.size())
+    {
+        usage(program);
+    }
+
+    return count;
+}
+
+BenchOptions parseCommandLine(std::span<char *> args)
+{
+    BenchOptions options;
+
+    for (std::string_view arg : args.subspan(1))
+    {
+        std::string_view value{ arg.substr(arg.find('=') + 1) };
+
+        if (arg.starts_with("--database="))
+        {
+            options.database = value;
+        }
+        else if (arg.starts_with("--rows="))
+        {
+            options.rows = parseCount(value, args.front());
+        }
+        else if (arg.starts_with("--operations="))
+        {
+            options.operations = parseCount(value, args.front());
+        }
+        else if (arg.starts_with("--seed="))
+        {
+            options.seed = parseCount(value, args.front());
+        }
+        else if (arg.starts_with("--filter="))
+        {
+            options.filter = value;
+        }
+        else
+        {
+            usage(args.front());
+        }
+    }
+
+    return options;
+}
+
+// Highest resident set size of the process so far, in MiB.
+double peakResidentMiB()
+{
+    rusage usage{};
+    ::getrusage(RUSAGE_SELF, &usage);
+
+    return static_cast<double>(usage.ru_maxrss) / 1024.0;
+}
+
+// Times benchmarks and reports one line for each.  Results are folded into a
+// checksum, reported at the end, so no benchmark's work can be optimised out.
+class BenchRunner
+{
+public:
+    explicit BenchRunner(std::string_view filter)
+    : m_filter{ filter }
+    {
+        std::println("{:<24} {:>12} {:>12} {:>14} {:>14}", "benchmark", "operations", "ns/op", "ops/s",
+                     "peak RSS MiB");
+    }
+
+    ~BenchRunner()
+    {
+        std::println("checksum {}", m_checksum);
+    }
+
+    BenchRunner(BenchRunner const &) = delete;
+    BenchRunner &operator=(BenchRunner const &) = delete;
+
+    // Runs `body`, which performs `operations` operations and returns a value
+    // depending on all of them, unless filtered out.  Returns whether it ran.
+    template<typename Body>
+    bool run(std::string_view name, std::uint64_t operations, Body &&body)
+    {
+        if (!name.contains(m_filter))
+        {
+            return false;
+        }
+
+        auto start{ std::chrono::steady_clock::now() };
+        std::uint64_t result = body();
+        std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+        m_checksum += result;
+
+        double count{ static_cast<double>(operations) };
+
+        std::println("{:<24} {:>12} {:>12.1f} {:>14.0f} {:>14.1f}", name, operations,
+                     elapsed.count() * 1e9 / count, count / elapsed.count(), peakResidentMiB());
+
+        return true;
+    }
+
+    // As `run`, but benchmarks that later ones depend on still run, untimed,
+    // when filtered out.
+    template<typename Body>
+    void setUp(std::string_view name, std::uint64_t operations, Body &&body)
+    {
+        if (!run(name, operations, body))
+        {
+            m_checksum += body();
+        }
+    }
+
+private:
+    std::string_view m_filter;
+    std::uint64_t m_checksum{};
+};
+
+// Lines of the database after its header.
+std::vector<std::string_view> recordLines(std::string_view contents)
+{
+    std::vector<std::string_view> lines;
+    std::size_t position{ contents.find('\n') };
+
+    while (position != std::string_view::npos && position + 1 < contents.size())
+    {
+        std::size_t end{ contents.find('\n', position + 1) };
+        lines.push_back(contents.substr(position + 1, (end == std::string_view::npos ? contents.size() : end)
+                                                      - position - 1));
+        position = end;
+    }
+
+    return lines;
+}
+
+void runBenchmarks(BenchOptions const &options, std::filesystem::path const &database)
+{
+    BenchRunner bench{ options.filter };
+
+    bench.run("load stream", options.rows, [&]
+        {
+            return populateEmployeesFromFile(database).size();
+        });
+
+    bench.run("load parallel", options.rows, [&]
+        {
+            MappedFile mapping;
+            return populateEmployeesInParallel(database, mapping).size();
+        });
+
+    // The mapped load is kept for the benchmarks that follow.
+    MappedFile mapping;
+    EmployeeStore loaded;
+
+    bench.setUp("load mapped", options.rows, [&]
+        {
+            loaded = populateEmployeesFromMapping(database, mapping);
+            return loaded.size();
+        });
+
+    std::vector<std::string_view> lines{ recordLines(mapping.contents()) };
+
+    bench.run("makeEmployee", lines.size(), [&]
+        {
+            EmployeeStore store;
+            store.reserve(lines.size());
+
+            for (std::string_view line : lines)
+            {
+                makeEmployee(line, store);
+            }
+
+            return store.size();
+        });
+
+    EmployeeDatabase employees;
+
+    bench.setUp("index build", loaded.size(), [&]
+        {
+            employees.assign(std::move(loaded));
+            return employees.size();
+        });
+
+    if (employees.size() == 0)
+    {
+        return;
+    }
+
+    // Probes are drawn before timing, from records that exist.
+    std::mt19937_64 random{ options.seed };
+    std::vector<unsigned> ids;
+    std::vector<std::string> names;
+    unsigned highestID{};
+
+    employees.forEach([&](Employee const &employee)
+        {
+            ids.push_back(employee.getID());
+            highestID = std::max(highestID, employee.getID());
+        });
+
+    std::uniform_int_distribution<std::size_t> pick{ 0, ids.size() - 1 };
+    std::vector<unsigned> probes(options.operations);
+
+    for (unsigned &probe : probes)
+    {
+        probe = ids[pick(random)];
+    }
+
+    for (std::size_t i{}; i < std::min<std::uint64_t>(options.operations, 1 << 16); ++i)
+    {
+        names.emplace_back(employees.find(ids[pick(random)])->getName());
+    }
+
+    bench.run("find id", probes.size(), [&]
+        {
+            std::uint64_t found{};
+
+            for (unsigned id : probes)
+            {
+                found += employees.find(id)->getID();
+            }
+
+            return found;
+        });
+
+    bench.run("find id miss", probes.size(), [&]
+        {
+            std::uint64_t found{};
+
+            for (unsigned id : probes)
+            {
+                found += employees.contains(id + highestID + 1);
+            }
+
+            return found;
+        });
+
+    bench.run("searchByName", options.operations, [&]
+        {
+            std::uint64_t found{};
+
+            for (std::uint64_t i{}; i < options.operations; ++i)
+            {
+                found += employees.findByName(names[i % names.size()]).size();
+            }
+
+            return found;
+        });
+
+    bench.run("format Employee", employees.size(), [&]
+        {
+            std::string rendered;
+            std::uint64_t bytes{};
+
+            employees.forEach([&](Employee const &employee)
+                {
+                    std::format_to(std::back_inserter(rendered), "{}", employee);
+
+                    if (rendered.size() >= std::size_t{ 1 } << 16)
+                    {
+                        bytes += rendered.size();
+                        rendered.clear();
+                    }
+                });
+
+            return bytes + rendered.size();
+        });
+
+    // New employees take IDs above every existing one, and the same names as
+    // existing ones.
+    unsigned const firstNew{ highestID + 1 };
+    unsigned const added{ static_cast<unsigned>(options.operations) };
+    Role const manager{ *parseRole("ManagerEmployee") };
+    Role const general{ *parseRole("GeneralEmployee") };
+
+    bench.setUp("add", added, [&]
+        {
+            for (unsigned i{}; i < added; ++i)
+            {
+                employees.add(EmployeeBuilder{ firstNew + i, names[i % names.size()], "benchpass", general });
+            }
+
+            return employees.size();
+        });
+
+    bench.run("retitle", added, [&]
+        {
+            for (unsigned i{}; i < added; ++i)
+            {
+                employees.changeRole(firstNew + i, manager);
+            }
+
+            return employees.size();
+        });
+
+    bench.run("remove", added, [&]
+        {
+            for (unsigned i{}; i < added; ++i)
+            {
+                employees.remove(firstNew + i);
+            }
+
+            return employees.size();
+        });
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    BenchOptions options{ parseCommandLine({ argv, static_cast<std::size_t>(argc) }) };
+    std::filesystem::path database{ options.database };
+
+    if (database.empty())
+    {
+        database = std::filesystem::temp_directory_path() / std::format("employeeBench.{}.csv", ::getpid());
+
+        auto start{ std::chrono::steady_clock::now() };
+
+        if (!generateDataset(database, options.rows, options.seed))
+        {
+            std::println(stderr, "Failed to write {}", database.string());
+            return 1;
+        }
+
+        std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+        std::println("Generated {} employees in {:.3f} s.", options.rows, elapsed.count());
+    }
+    else
+    {
+        // Throughput of the load benchmarks is reported per record.
+        MappedFile mapping{ database };
+        options.rows = recordLines(mapping.contents()).size();
+    }
+
+    runBenchmarks(options, database);
+
+    if (options.database.empty())
+    {
+        std::filesystem::remove(database);
+    }
+
+    return 0;
+}
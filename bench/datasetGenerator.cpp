@@ -0,0 +1,120 @@
+//******************************************************************************
+//File Name: datasetGenerator.cpp
+//Description: Implementation for the synthetic employee database generator.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "datasetGenerator.hpp"
+#include "bulkWriter.hpp"
+#include "employeeLoader.hpp"
+#include "roles.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <string_view>
+#include <vector>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+constexpr std::array<std::string_view, 48> firstNames{
+    "James", "Mary", "Robert", "Patricia", "John", "Jennifer", "Michael", "Linda",
+    "David", "Elizabeth", "William", "Barbara", "Richard", "Susan", "Joseph", "Jessica",
+    "Thomas", "Sarah", "Charles", "Karen", "Christopher", "Lisa", "Daniel", "Nancy",
+    "Matthew", "Betty", "Anthony", "Margaret", "Mark", "Sandra", "Donald", "Ashley",
+    "Steven", "Kimberly", "Paul", "Emily", "Andrew", "Donna", "Joshua", "Michelle",
+    "Kenneth", "Carol", "Kevin", "Amanda", "Brian", "Dorothy", "George", "Melissa",
+};
+
+constexpr std::array<std::string_view, 48> lastNames{
+    "Smith", "Johnson", "Williams", "Brown", "Jones", "Garcia", "Miller", "Davis",
+    "Rodriguez", "Martinez", "Hernandez", "Lopez", "Gonzalez", "Wilson", "Anderson", "Thomas",
+    "Taylor", "Moore", "Jackson", "Martin", "Lee", "Perez", "Thompson", "White",
+    "Harris", "Sanchez", "Clark", "Ramirez", "Lewis", "Robinson", "Walker", "Young",
+    "Allen", "King", "Wright", "Scott", "Torres", "Nguyen", "Hill", "Flores",
+    "Green", "Adams", "Nelson", "Baker", "Hall", "Rivera", "Campbell", "Mitchell",
+};
+
+// Share of employees in each role of the role table, in table order.
+constexpr std::array<double, roleCount> roleWeights{ 80.0, 5.0, 15.0 };
+
+// Picks entries of a name list with probability falling off as 1 / rank.
+std::discrete_distribution<std::size_t> zipf(std::size_t count)
+{
+    std::vector<double> weights(count);
+
+    for (std::size_t rank{}; rank < count; ++rank)
+    {
+        weights[rank] = 1.0 / static_cast<double>(rank + 1);
+    }
+
+    return { weights.begin(), weights.end() };
+}
+
+} // anonymous namespace
+
+bool generateDataset(std::filesystem::path const &path, std::uint64_t rows, std::uint64_t seed)
+{
+    int fd{ ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644) };
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    constexpr std::string_view passwordCharacters{ "abcdefghijklmnopqrstuvwxyz0123456789" };
+
+    std::mt19937_64 random{ seed };
+    auto firstName{ zipf(firstNames.size()) };
+    auto lastName{ zipf(lastNames.size()) };
+    std::discrete_distribution<std::size_t> role{ roleWeights.begin(), roleWeights.end() };
+    std::uniform_int_distribution<std::size_t> passwordLength{ 8, 14 };
+    std::bernoulli_distribution skipID{ 0.25 };
+
+    bool written{};
+
+    {
+        BulkWriter writer{ fd };
+        writer.println("{}", csvHeader);
+
+        std::array<char, 16> password{};
+        std::uint64_t id{};
+
+        for (std::uint64_t row{}; row < rows; ++row, ++id)
+        {
+            // Leave gaps, so that some IDs in range are missing.
+            id += skipID(random);
+
+            std::size_t length{ passwordLength(random) };
+
+            // Each draw yields twelve characters, enough for most passwords.
+            std::uint64_t bits{};
+
+            for (std::size_t i{}; i < length; ++i)
+            {
+                if (i % 12 == 0)
+                {
+                    bits = random();
+                }
+
+                password[i] = passwordCharacters[bits % passwordCharacters.size()];
+                bits /= passwordCharacters.size();
+            }
+
+            writer.println("{},{} {},{},{}", id, firstNames[firstName(random)], lastNames[lastName(random)],
+                           std::string_view{ password.data(), length }, roleTable[role(random)].name);
+        }
+
+        writer.flush();
+        written = !writer.failed();
+    }
+
+    return ::close(fd) == 0 && written;
+}
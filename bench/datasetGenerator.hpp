@@ -0,0 +1,22 @@
+//******************************************************************************
+//File Name: datasetGenerator.hpp
+//Description: Synthetic employee databases for benchmarking.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef DATASET_GENERATOR_HPP
+#define DATASET_GENERATOR_HPP
+
+#include <cstdint>
+#include <filesystem>
+
+
+// Writes a CSV employee database of `rows` records to `path`, identical for
+// the same `seed`.  IDs ascend with occasional gaps, names are drawn from
+// common first and last names with a Zipf-like skew, so many are shared,
+// and most employees are general employees, with fewer managers and fewer
+// still in human resources.  Returns false if the file could not be written.
+bool generateDataset(std::filesystem::path const &path, std::uint64_t rows, std::uint64_t seed);
+
+#endif
@@ -0,0 +1,93 @@
+//******************************************************************************
+//File Name: generateEmployees.cpp
+//Description: Writes synthetic employee databases for benchmarking.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "datasetGenerator.hpp"
+
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <print>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+[[noreturn]]
+void usage(std::string_view program)
+{
+    std::println("Usage: {} [--rows=<count>] [--seed=<number>] <output.csv>", program);
+    std::exit(1);
+}
+
+std::uint64_t parseCount(std::string_view text, std::string_view program)
+{
+    std::uint64_t count{};
+    auto [end, error]{ std::from_chars(text.data(), text.data() + text.size(), count) };
+
+    if (error != std::errc{} || end != text.data() + text.size())
+    {
+        usage(program);
+    }
+
+    return count;
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    std::span<char *> args{ argv, static_cast<std::size_t>(argc) };
+
+    std::uint64_t rows{ 1'000'000 };
+    std::uint64_t seed{ 1 };
+    std::optional<std::filesystem::path> output;
+
+    for (std::string_view arg : args.subspan(1))
+    {
+        if (arg.starts_with("--rows="))
+        {
+            rows = parseCount(arg.substr(arg.find('=') + 1), args.front());
+        }
+        else if (arg.starts_with("--seed="))
+        {
+            seed = parseCount(arg.substr(arg.find('=') + 1), args.front());
+        }
+        else if (!arg.starts_with("--") && !output)
+        {
+            output = arg;
+        }
+        else
+        {
+            usage(args.front());
+        }
+    }
+
+    if (!output)
+    {
+        usage(args.front());
+    }
+
+    auto start{ std::chrono::steady_clock::now() };
+
+    if (!generateDataset(*output, rows, seed))
+    {
+        std::println(stderr, "Failed to write {}", output->string());
+        return 1;
+    }
+
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::println("Wrote {} employees to {} in {:.3f} s.", rows, output->string(), elapsed.count());
+    return 0;
+}
@@ -0,0 +1,85 @@
+#!/bin/bash
+
+# Builds the release executable with profile guided optimisation: builds it
+# instrumented, trains it on a generated database and rebuilds it with the
+# profile.  The training workload is timed with the plain release build and
+# with the result, so the gain is visible.
+#
+# Usage: ./pgo.sh [rows], rows defaults to 1000000.
+
+set -euo pipefail
+
+build=build-release
+rows=${1:-1000000}
+training=${build}/training
+
+# Runs the training workload with the executable $1: every load mode, a
+# snapshot, log replay, a full bulk listing and a batch of commands.
+train() {
+    local app=$1
+    local database=${training}/employees.csv
+
+    rm -f "${database}.log" "${training}/employees.snapshot"
+
+    "${app}" --database="${database}" --load=stream --batch="${training}/login.txt" --save-interval=0 > /dev/null
+    "${app}" --database="${database}" --load=parallel --batch="${training}/login.txt" --save-interval=0 > /dev/null
+    "${app}" --database="${database}" --snapshot="${training}/employees.snapshot" --build-snapshot > /dev/null
+    "${app}" --database="${database}" --snapshot="${training}/employees.snapshot" \
+             --batch="${training}/commands.txt" --save-interval=0 > /dev/null 2>&1
+
+    # The commands above are still in the log, so this start replays them.
+    printf '%s\n%s\n1\n\n0\n' "${hrID}" "${hrPassword}" \
+        | "${app}" --database="${database}" --output=bulk --save-interval=0 > /dev/null 2>&1
+
+    rm -f "${database}.log" "${training}/employees.snapshot"
+}
+
+timeTraining() {
+    local TIMEFORMAT="$2: training workload took %R s"
+    time train "$1"
+}
+
+cmake -B "${build}" -DPGO=GENERATE
+cmake --build "${build}" --target assignment1-release generateEmployees
+
+mkdir -p "${training}"
+"${build}/bin/generateEmployees" --rows="${rows}" "${training}/employees.csv"
+
+# Sign in as the first human resources employee, who may do everything.
+read -r hrID hrPassword < <(awk -F, '$4 == "HumanResourcesEmployee" { print $1, $3; exit }' \
+                                "${training}/employees.csv")
+
+printf 'login,%s,%s\n' "${hrID}" "${hrPassword}" > "${training}/login.txt"
+
+# Searches, additions, modifications and removals spread over the database.
+# Names are widely shared, so searches by name are kept rare.
+awk -F, -v id="${hrID}" -v password="${hrPassword}" '
+    BEGIN { print "login," id "," password }
+    NR > 1 && NR % 10 == 0 {
+        print "search,id," $1
+    }
+    NR > 1 && NR % 1000 == 0 {
+        print "search,name," $2
+        print "search,prefix," substr($2, 1, 3)
+    }
+    NR > 1 && NR % 50 == 0 && $1 != id {
+        print "add," ($1 + 100000000) "," $2 "," $3 ",GeneralEmployee"
+        print "modify," $1 ",title,ManagerEmployee"
+        print "modify," $1 ",name," $2 " Jr"
+        print "modify," $1 ",password,changed"
+        print "remove," ($1 + 100000000)
+    }
+' "${training}/employees.csv" > "${training}/commands.txt"
+
+rm -rf "${build}/pgo"
+train "${build}/bin/assignment1-release"
+
+cmake -B "${build}" -DPGO=OFF
+cmake --build "${build}" --target assignment1-release
+timeTraining "${build}/bin/assignment1-release" "Release"
+
+cmake -B "${build}" -DPGO=USE
+cmake --build "${build}" --target assignment1-release
+timeTraining "${build}/bin/assignment1-release" "Release with PGO"
+
+echo "Built ${build}/bin/assignment1-release"
@@ -9,5 +9,5 @@ fi
 cmake --build build
 
 # Run application.
-./build/bin/assignment1
+./build/bin/assignment1 "$@"
 
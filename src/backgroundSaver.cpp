@@ -0,0 +1,147 @@
+//******************************************************************************
+//File Name: backgroundSaver.cpp
+//Description: Implementation for BackgroundSaver object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "backgroundSaver.hpp"
+#include "bulkWriter.hpp"
+#include "employeeLoader.hpp"
+#include "fileStamp.hpp"
+#include "roles.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <print>
+#include <system_error>
+#include <utility>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+// Writes the live records of `employees` as a CSV database at `path`.
+bool writeDatabase(EmployeeStore const &employees, std::filesystem::path const &path)
+{
+    int fd{ ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644) };
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    bool written{};
+
+    {
+        BulkWriter writer{ fd };
+        writer.println("{}", csvHeader);
+
+        for (std::uint32_t position{}; position < employees.size(); ++position)
+        {
+            if (employees.isLive(position))
+            {
+                writer.println("{},{},{},{}", employees.id(position), employees.name(position),
+                               employees.password(position), roleInfo(employees.role(position)).name);
+            }
+        }
+
+        writer.flush();
+        written = !writer.failed();
+    }
+
+    written = written && ::fsync(fd) == 0;
+    ::close(fd);
+
+    return written;
+}
+
+} // anonymous namespace
+
+BackgroundSaver::BackgroundSaver(EmployeeDatabase const &employees, std::filesystem::path database,
+                                 OperationLog *log, std::chrono::seconds interval)
+: m_employees{ employees }
+, m_database{ std::move(database) }
+, m_log{ log }
+, m_interval{ interval }
+, m_saver{ [this](std::stop_token stop) { run(stop); } }
+{}
+
+BackgroundSaver::~BackgroundSaver()
+{
+    m_saver.request_stop();
+    m_saver.join();
+
+    saveIfChanged();
+}
+
+void BackgroundSaver::run(std::stop_token stop)
+{
+    std::unique_lock lock{ m_mutex };
+
+    while (true)
+    {
+        m_wake.wait_for(lock, stop, m_interval, [] { return false; });
+
+        if (stop.stop_requested())
+        {
+            return;  // The destructor saves what remains.
+        }
+
+        lock.unlock();
+        saveIfChanged();
+        lock.lock();
+    }
+}
+
+bool BackgroundSaver::saveIfChanged()
+{
+    if (m_employees.changeCount() == m_savedChanges)
+    {
+        return true;
+    }
+
+    // Copying the columns is the only work done while modifications wait,
+    // formatting and writing happen on the copy.
+    Checkpoint checkpoint{ m_employees.checkpoint() };
+
+    std::filesystem::path temporary{ m_database };
+    temporary += ".tmp";
+
+    if (!writeDatabase(checkpoint.employees, temporary))
+    {
+        std::println(stderr, "Failed to save employee database to {}: {}", temporary.string(), std::strerror(errno));
+        return false;
+    }
+
+    auto publish{ [&]
+        {
+            std::error_code error;
+            std::filesystem::rename(temporary, m_database, error);
+
+            if (error)
+            {
+                std::println(stderr, "Failed to replace employee database {}: {}", m_database.string(), error.message());
+            }
+
+            return !error;
+        } };
+
+    bool saved{ m_log ? m_log->checkpoint(checkpoint.logPosition, stampOf(temporary), publish) : publish() };
+
+    if (saved)
+    {
+        m_savedChanges = checkpoint.changes;
+    }
+    else
+    {
+        std::error_code error;
+        std::filesystem::remove(temporary, error);
+    }
+
+    return saved;
+}
@@ -0,0 +1,64 @@
+//******************************************************************************
+//File Name: backgroundSaver.hpp
+//Description: Periodically writes the employee database back to disk.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef BACKGROUND_SAVER_HPP
+#define BACKGROUND_SAVER_HPP
+
+#include "employeeDatabase.hpp"
+#include "operationLog.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+
+// Saves the employee database to its CSV file on a thread of its own, every
+// `interval` and on destruction, but only when it has changed since the last
+// save.  Each save writes a point in time copy to a temporary file that is
+// renamed over the database, so the database on disk is always complete, and
+// checkpoints the operation log so it only holds the changes made since.
+class BackgroundSaver
+{
+public:
+    static constexpr std::chrono::seconds defaultInterval{ 30 };
+
+    // `employees` and `log`, which may be null, must outlive the saver.
+    BackgroundSaver(EmployeeDatabase const &employees, std::filesystem::path database, OperationLog *log,
+                    std::chrono::seconds interval = defaultInterval);
+
+    // Stops the saver thread and saves any remaining changes.
+    ~BackgroundSaver();
+
+    BackgroundSaver(BackgroundSaver const &) = delete;
+    BackgroundSaver &operator=(BackgroundSaver const &) = delete;
+
+private:
+    void run(std::stop_token stop);
+
+    // Saves if anything has changed, returns false if saving failed.
+    bool saveIfChanged();
+
+    EmployeeDatabase const &m_employees;
+    std::filesystem::path m_database;
+    OperationLog *m_log;
+    std::chrono::seconds m_interval;
+
+    // Change count of the database as last saved.  The database as loaded has
+    // none, so changes replayed from the log are saved too.
+    std::uint64_t m_savedChanges{};
+
+    // Only used to wait out the interval, or until stopped.
+    std::mutex m_mutex;
+    std::condition_variable_any m_wake;
+
+    std::jthread m_saver;           // Declared last, so started last.
+};
+
+#endif
@@ -0,0 +1,496 @@
+//******************************************************************************
+//File Name: batchMode.cpp
+//Description: Implementation for batch command mode.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "batchMode.hpp"
+#include "employeeQuery.hpp"
+#include "employees.hpp"
+#include "fieldScanner.hpp"
+#include "operationStatistics.hpp"
+#include "roles.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+// One more than the longest command, so extra fields can be detected.
+constexpr std::size_t maxCommandFields{ 7 };
+
+using Fields = std::span<std::string_view const>;
+
+// Reason a command failed, empty on success.
+using Failure = std::string_view;
+
+constexpr Failure succeeded{};
+
+struct BatchState
+{
+    EmployeeDatabase &employees;
+    BulkWriter &output;
+    std::optional<EmployeeHandle> user;
+    std::size_t line{};
+};
+
+bool parseID(std::string_view field, unsigned &id)
+{
+    return !field.empty() && parseEmployeeID(field, id);
+}
+
+// Parses an offset or limit, which must be all digits.
+bool parseCount(std::string_view field, std::size_t &count)
+{
+    auto [end, error]{ std::from_chars(field.data(), field.data() + field.size(), count) };
+    return !field.empty() && error == std::errc{} && end == field.data() + field.size();
+}
+
+// Prints the fields the menus show for `employee`, never its password.
+void printMatch(BatchState &state, Employee const &employee)
+{
+    state.output.println("{},found,{},{},{}", state.line, employee.getID(), employee.getName(),
+                         roleInfo(employee.getRole()).name);
+}
+
+Failure login(BatchState &state, Fields fields)
+{
+    unsigned id{};
+
+    if (fields.size() != 3)
+    {
+        return "wrong number of fields";
+    }
+
+    if (!parseID(fields[1], id))
+    {
+        return "invalid ID";
+    }
+
+    std::optional<Employee> found{ state.employees.find(id) };
+
+    if (!found || !found->isCorrectPassword(fields[2]))
+    {
+        state.user.reset();
+        return "incorrect ID or password";
+    }
+
+    state.user = found->handle();
+    return succeeded;
+}
+
+Failure add(BatchState &state, Employee const &user, Fields fields)
+{
+    unsigned id{};
+
+    if (fields.size() != 5)
+    {
+        return "wrong number of fields";
+    }
+
+    if (!user.canAddEmployee())
+    {
+        return "permission denied";
+    }
+
+    if (!parseID(fields[1], id))
+    {
+        return "invalid ID";
+    }
+
+    if (state.employees.contains(id))
+    {
+        return "ID already exists";
+    }
+
+    if (!isValidField(fields[2]))
+    {
+        return "invalid name";
+    }
+
+    if (!isValidField(fields[3]))
+    {
+        return "invalid password";
+    }
+
+    auto role{ parseRole(fields[4]) };
+
+    if (!role)
+    {
+        return "invalid role";
+    }
+
+    state.employees.add(EmployeeBuilder{ id, fields[2], fields[3], *role });
+    return succeeded;
+}
+
+Failure remove(BatchState &state, Employee const &user, Fields fields)
+{
+    unsigned id{};
+
+    if (fields.size() != 2)
+    {
+        return "wrong number of fields";
+    }
+
+    if (!user.canRemoveEmployee())
+    {
+        return "permission denied";
+    }
+
+    if (!parseID(fields[1], id))
+    {
+        return "invalid ID";
+    }
+
+    if (!state.employees.contains(id))
+    {
+        return "ID not found";
+    }
+
+    state.employees.remove(id);
+    return succeeded;
+}
+
+Failure modify(BatchState &state, Employee const &user, Fields fields)
+{
+    unsigned id{};
+
+    if (fields.size() != 4)
+    {
+        return "wrong number of fields";
+    }
+
+    if (!user.canModifyEmployee())
+    {
+        return "permission denied";
+    }
+
+    if (!parseID(fields[1], id))
+    {
+        return "invalid ID";
+    }
+
+    if (!state.employees.contains(id))
+    {
+        return "ID not found";
+    }
+
+    std::string_view field{ fields[2] };
+    std::string_view value{ fields[3] };
+
+    if (field == "id")
+    {
+        unsigned newID{};
+
+        if (!parseID(value, newID))
+        {
+            return "invalid ID";
+        }
+
+        if (state.employees.contains(newID))
+        {
+            return "ID already exists";
+        }
+
+        state.employees.changeID(id, newID);
+    }
+    else if (field == "name")
+    {
+        if (!isValidField(value))
+        {
+            return "invalid name";
+        }
+
+        state.employees.rename(id, value);
+    }
+    else if (field == "password")
+    {
+        if (!isValidField(value))
+        {
+            return "invalid password";
+        }
+
+        state.employees.changePassword(id, value);
+    }
+    else if (field == "title")
+    {
+        auto role{ parseRole(value) };
+
+        if (!role)
+        {
+            return "invalid role";
+        }
+
+        state.employees.changeRole(id, *role);
+    }
+    else
+    {
+        return "unknown field";
+    }
+
+    return succeeded;
+}
+
+Failure search(BatchState &state, Employee const &user, Fields fields)
+{
+    if (fields.size() != 3)
+    {
+        return "wrong number of fields";
+    }
+
+    if (!user.canSearchEmployees())
+    {
+        return "permission denied";
+    }
+
+    std::string_view type{ fields[1] };
+    std::string_view value{ fields[2] };
+
+    if (type == "id")
+    {
+        unsigned id{};
+
+        if (!parseID(value, id))
+        {
+            return "invalid ID";
+        }
+
+        if (auto found{ state.employees.find(id) })
+        {
+            printMatch(state, *found);
+        }
+    }
+    else if (type == "name")
+    {
+        for (unsigned id : state.employees.findByName(value))
+        {
+            printMatch(state, *state.employees.find(id));
+        }
+    }
+    else if (type == "prefix")
+    {
+        state.employees.forEachWithNamePrefix(value, [&state](Employee const &employee)
+            {
+                printMatch(state, employee);
+            });
+    }
+    else if (type == "query")
+    {
+        std::string_view error;
+        std::optional<EmployeeQuery> query{ EmployeeQuery::compile(value, error) };
+
+        if (!query)
+        {
+            return error;
+        }
+
+        for (Employee const &employee : state.employees.select(*query))
+        {
+            printMatch(state, employee);
+        }
+    }
+    else
+    {
+        return "unknown search type";
+    }
+
+    return succeeded;
+}
+
+Failure headcount(BatchState &state, Employee const &user, Fields fields)
+{
+    if (fields.size() != 1)
+    {
+        return "wrong number of fields";
+    }
+
+    if (!user.canViewReports())
+    {
+        return "permission denied";
+    }
+
+    for (std::size_t role{}; role < roleCount; ++role)
+    {
+        state.output.println("{},count,{},{}", state.line, roleTable[role].name,
+                             state.employees.countWithRole(Role{ static_cast<std::uint8_t>(role) }));
+    }
+
+    return succeeded;
+}
+
+Failure list(BatchState &state, Employee const &user, Fields fields)
+{
+    std::string_view order{ fields.size() > 1 ? fields[1] : std::string_view{} };
+    bool isRange{ order == "range" };
+    bool isRole{ order == "role" };
+
+    if (fields.size() != (isRange ? 6u : isRole ? 5u : 4u))
+    {
+        return "wrong number of fields";
+    }
+
+    if (!(isRole ? user.canViewReports() : user.canBrowseEmployees()))
+    {
+        return "permission denied";
+    }
+
+    std::size_t offset{};
+    std::size_t limit{};
+
+    if (!parseCount(fields[fields.size() - 2], offset) || !parseCount(fields.back(), limit))
+    {
+        return "invalid offset or limit";
+    }
+
+    // Only the fields the browsing and headcount screens show, so a manager
+    // listing a role learns no more than the report tells them.
+    auto print{ [&state](Employee const &employee) { printMatch(state, employee); } };
+
+    if (isRange)
+    {
+        unsigned low{};
+        unsigned high{};
+
+        if (!parseID(fields[2], low) || !parseID(fields[3], high))
+        {
+            return "invalid ID";
+        }
+
+        state.employees.forEachInIDRange(low, high, offset, limit, print);
+    }
+    else if (isRole)
+    {
+        std::optional<Role> role{ parseRole(fields[2]) };
+
+        if (!role)
+        {
+            return "invalid role";
+        }
+
+        state.employees.forEachWithRole(*role, offset, limit, print);
+    }
+    else if (order == "id")
+    {
+        state.employees.forEachInOrder(EmployeeOrder::id, offset, limit, print);
+    }
+    else if (order == "name")
+    {
+        state.employees.forEachInOrder(EmployeeOrder::name, offset, limit, print);
+    }
+    else if (order == "title")
+    {
+        state.employees.forEachInOrder(EmployeeOrder::title, offset, limit, print);
+    }
+    else
+    {
+        return "unknown order";
+    }
+
+    return succeeded;
+}
+
+Failure execute(BatchState &state, Fields fields)
+{
+    std::string_view command{ fields[0] };
+
+    if (command == "login")
+    {
+        OperationTimer timer{ Operation::login };
+        return login(state, fields);
+    }
+
+    if (command != "add" && command != "remove" && command != "modify" && command != "search" && command != "list"
+        && command != "headcount")
+    {
+        return "unknown command";
+    }
+
+    // Users may remove themselves, which logs them out.
+    std::optional<Employee> user;
+
+    if (state.user)
+    {
+        user = state.employees.find(*state.user);
+    }
+
+    if (!user)
+    {
+        return "not logged in";
+    }
+
+    if (command == "add")
+    {
+        OperationTimer timer{ Operation::add };
+        return add(state, *user, fields);
+    }
+
+    if (command == "remove")
+    {
+        OperationTimer timer{ Operation::remove };
+        return remove(state, *user, fields);
+    }
+
+    if (command == "modify")
+    {
+        OperationTimer timer{ Operation::modify };
+        return modify(state, *user, fields);
+    }
+
+    if (command == "list")
+    {
+        OperationTimer timer{ Operation::view };
+        return list(state, *user, fields);
+    }
+
+    if (command == "headcount")
+    {
+        OperationTimer timer{ Operation::view };
+        return headcount(state, *user, fields);
+    }
+
+    OperationTimer timer{ Operation::search };
+    return search(state, *user, fields);
+}
+
+} // anonymous namespace
+
+BatchSummary runBatch(std::string_view commands, EmployeeDatabase &employees, BulkWriter &output)
+{
+    BatchState state{ employees, output, std::nullopt };
+    BatchSummary summary;
+
+    forEachRecord<maxCommandFields>(commands, [&](std::string_view line, Fields fields)
+        {
+            ++state.line;
+
+            if (line.empty() || line.starts_with('#'))
+            {
+                return true;
+            }
+
+            ++summary.commands;
+
+            if (Failure failure{ execute(state, fields) }; !failure.empty())
+            {
+                ++summary.failed;
+                output.println("{},error,{}", state.line, failure);
+            }
+            else
+            {
+                output.println("{},ok", state.line);
+            }
+
+            return true;
+        });
+
+    return summary;
+}
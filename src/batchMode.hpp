@@ -0,0 +1,49 @@
+//******************************************************************************
+//File Name: batchMode.hpp
+//Description: Runs employee operations from a command file without prompts.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef BATCH_MODE_HPP
+#define BATCH_MODE_HPP
+
+#include "bulkWriter.hpp"
+#include "employeeDatabase.hpp"
+
+#include <cstddef>
+#include <string_view>
+
+
+// Commands are one per line with comma separated fields, in the style of the
+// CSV database.  Blank lines and lines starting with '#' are ignored.
+//
+//   login,<id>,<password>
+//   add,<id>,<name>,<password>,<role>
+//   remove,<id>
+//   modify,<id>,id|name|password|title,<value>
+//   search,id|name|prefix|query,<value>
+//   list,id|name|title,<offset>,<limit>
+//   list,range,<first id>,<last id>,<offset>,<limit>
+//   list,role,<role>,<offset>,<limit>
+//   headcount
+//
+// Every command other than login requires a logged in user with the same
+// capability as the matching menu entry.  Each command produces a result line
+// of `<line>,ok` or `<line>,error,<reason>`, where `<line>` is its line number
+// in the file.  Searches first produce a `<line>,found,<id>,<name>,<role>`
+// line for each match, the fields the menus show, as do lists for each
+// employee listed.  Passwords are never printed.  Queries are written as described for EmployeeQuery, without
+// commas.  Headcounts first produce a `<line>,count,<role>,<count>` line for
+// each role.
+
+struct BatchSummary
+{
+    std::size_t commands{};
+    std::size_t failed{};
+};
+
+// Runs every command in `commands` in order, writing the results to `output`.
+BatchSummary runBatch(std::string_view commands, EmployeeDatabase &employees, BulkWriter &output);
+
+#endif
@@ -0,0 +1,428 @@
+//******************************************************************************
+//File Name: boundedEmployeeDatabase.cpp
+//Description: Implementation for BoundedEmployeeDatabase object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "boundedEmployeeDatabase.hpp"
+#include "bulkWriter.hpp"
+#include "fieldScanner.hpp"
+#include "fileStamp.hpp"
+#include "roles.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <print>
+#include <system_error>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+// Heap bytes of `text`, zero while it fits the string's inline storage.
+std::size_t heapBytes(std::string const &text)
+{
+    return text.capacity() > std::string{}.capacity() ? text.capacity() + 1 : 0;
+}
+
+// Estimated footprint of caching `record`: the record in its list node with
+// two links, and the hash table node (link, key and iterator) and bucket
+// finding it, plus any heap storage of its strings.
+std::size_t cachedBytes(EmployeeRecord const &record)
+{
+    return sizeof(EmployeeRecord) + 6 * sizeof(void *) + heapBytes(record.name) + heapBytes(record.password);
+}
+
+EmployeeRecord toRecord(EmployeeBuilder const &params)
+{
+    return { params.id, std::string{ params.name }, std::string{ params.password }, params.role };
+}
+
+// Parses `line`, or returns nullopt if it is malformed.
+std::optional<EmployeeRecord> parseRecord(std::string_view line)
+{
+    std::optional<EmployeeRecord> record;
+
+    forEachRecord(line, [&record](std::string_view, std::span<std::string_view const> fields)
+        {
+            if (std::optional<EmployeeBuilder> params{ parseEmployee(fields) })
+            {
+                record = toRecord(*params);
+            }
+
+            return false;
+        });
+
+    return record;
+}
+
+} // anonymous namespace
+
+BoundedEmployeeDatabase::BoundedEmployeeDatabase(std::filesystem::path path, std::size_t memoryBudget)
+: m_path{ std::move(path) }
+, m_budget{ memoryBudget }
+, m_file{ m_path }
+, m_size{ m_file.size() }
+{
+    if (!m_file.isOpen())
+    {
+        std::println("Employee database not found at {}", m_path.string());
+    }
+}
+
+void BoundedEmployeeDatabase::attachLog(OperationLog *log)
+{
+    std::lock_guard lock{ m_mutex };
+    m_log = log;
+}
+
+std::optional<EmployeeRecord> BoundedEmployeeDatabase::find(unsigned id) const
+{
+    std::lock_guard lock{ m_mutex };
+
+    if (auto changed{ m_changes.find(id) }; changed != m_changes.end())
+    {
+        ++m_hits;
+        return changed->second;
+    }
+
+    if (auto cached{ m_cached.find(id) }; cached != m_cached.end())
+    {
+        ++m_hits;
+        m_recent.splice(m_recent.begin(), m_recent, cached->second);
+        return *cached->second;
+    }
+
+    std::optional<std::string_view> line{ m_file.findLine(id) };
+
+    if (!line)
+    {
+        return std::nullopt;
+    }
+
+    ++m_misses;
+    std::optional<EmployeeRecord> record{ parseRecord(*line) };
+
+    if (record)
+    {
+        cache(*record);
+    }
+
+    return record;
+}
+
+bool BoundedEmployeeDatabase::contains(unsigned id) const
+{
+    std::lock_guard lock{ m_mutex };
+    return containsLocked(id);
+}
+
+bool BoundedEmployeeDatabase::containsLocked(unsigned id) const
+{
+    if (auto changed{ m_changes.find(id) }; changed != m_changes.end())
+    {
+        return changed->second.has_value();
+    }
+
+    return m_file.contains(id);
+}
+
+std::optional<EmployeeRecord> BoundedEmployeeDatabase::current(unsigned id) const
+{
+    if (auto changed{ m_changes.find(id) }; changed != m_changes.end())
+    {
+        return changed->second;
+    }
+
+    if (auto cached{ m_cached.find(id) }; cached != m_cached.end())
+    {
+        return *cached->second;
+    }
+
+    std::optional<std::string_view> line{ m_file.findLine(id) };
+
+    return line ? parseRecord(*line) : std::nullopt;
+}
+
+void BoundedEmployeeDatabase::change(unsigned id, std::optional<EmployeeRecord> record)
+{
+    uncache(id);
+
+    // Removing an employee the file never had leaves nothing to record.
+    if (!record && !m_file.contains(id))
+    {
+        m_changes.erase(id);
+    }
+    else
+    {
+        m_changes.insert_or_assign(id, std::move(record));
+    }
+
+    ++m_changeCount;
+}
+
+void BoundedEmployeeDatabase::add(EmployeeBuilder const &params)
+{
+    std::lock_guard lock{ m_mutex };
+
+    change(params.id, toRecord(params));
+    ++m_size;
+
+    if (m_log)
+    {
+        m_log->append({ .operation = LogOperation::add, .id = params.id, .role = params.role,
+                        .name = params.name, .password = params.password });
+    }
+}
+
+void BoundedEmployeeDatabase::remove(unsigned id)
+{
+    std::lock_guard lock{ m_mutex };
+
+    change(id, std::nullopt);
+    --m_size;
+
+    if (m_log)
+    {
+        m_log->append({ .operation = LogOperation::remove, .id = id });
+    }
+}
+
+void BoundedEmployeeDatabase::changeID(unsigned id, unsigned newID)
+{
+    std::lock_guard lock{ m_mutex };
+    EmployeeRecord record{ *current(id) };
+
+    change(id, std::nullopt);
+    record.id = newID;
+    change(newID, std::move(record));
+
+    if (m_log)
+    {
+        m_log->append({ .operation = LogOperation::changeID, .id = id, .newID = newID });
+    }
+}
+
+void BoundedEmployeeDatabase::rename(unsigned id, std::string_view name)
+{
+    std::lock_guard lock{ m_mutex };
+    EmployeeRecord record{ *current(id) };
+
+    record.name = name;
+    change(id, std::move(record));
+
+    if (m_log)
+    {
+        m_log->append({ .operation = LogOperation::rename, .id = id, .name = name });
+    }
+}
+
+void BoundedEmployeeDatabase::changePassword(unsigned id, std::string_view password)
+{
+    std::lock_guard lock{ m_mutex };
+    EmployeeRecord record{ *current(id) };
+
+    record.password = password;
+    change(id, std::move(record));
+
+    if (m_log)
+    {
+        m_log->append({ .operation = LogOperation::changePassword, .id = id, .password = password });
+    }
+}
+
+void BoundedEmployeeDatabase::changeRole(unsigned id, Role role)
+{
+    std::lock_guard lock{ m_mutex };
+    EmployeeRecord record{ *current(id) };
+
+    record.role = role;
+    change(id, std::move(record));
+
+    if (m_log)
+    {
+        m_log->append({ .operation = LogOperation::changeRole, .id = id, .role = role });
+    }
+}
+
+std::vector<unsigned> BoundedEmployeeDatabase::findByName(std::string_view name) const
+{
+    std::vector<unsigned> ids;
+
+    scan([name](unsigned, std::string_view candidate, Role) { return candidate == name; },
+         [&ids](EmployeeRecord const &employee) { ids.push_back(employee.id); });
+
+    return ids;
+}
+
+std::vector<EmployeeRecord> BoundedEmployeeDatabase::select(EmployeeQuery const &query) const
+{
+    std::vector<EmployeeRecord> employees;
+
+    if (query.matchesNothing())
+    {
+        return employees;
+    }
+
+    scan([&query](unsigned id, std::string_view name, Role role) { return query.matches(id, name, role); },
+         [&employees](EmployeeRecord const &employee) { employees.push_back(employee); });
+
+    std::ranges::sort(employees, {}, &EmployeeRecord::id);
+    return employees;
+}
+
+std::size_t BoundedEmployeeDatabase::size() const
+{
+    std::lock_guard lock{ m_mutex };
+    return m_size;
+}
+
+BoundedEmployeeDatabase::CacheStatistics BoundedEmployeeDatabase::cacheStatistics() const
+{
+    std::lock_guard lock{ m_mutex };
+
+    return { m_hits, m_misses, m_evictions, m_recent.size(), m_cachedBytes, m_budget, m_file.memoryUsage(),
+             m_changes.size() };
+}
+
+void BoundedEmployeeDatabase::cache(EmployeeRecord const &record) const
+{
+    std::size_t bytes{ cachedBytes(record) };
+
+    if (bytes > m_budget)
+    {
+        return;
+    }
+
+    while (m_cachedBytes + bytes > m_budget)
+    {
+        m_cachedBytes -= cachedBytes(m_recent.back());
+        m_cached.erase(m_recent.back().id);
+        m_recent.pop_back();
+        ++m_evictions;
+    }
+
+    m_recent.push_front(record);
+    m_cached.emplace(record.id, m_recent.begin());
+    m_cachedBytes += bytes;
+}
+
+void BoundedEmployeeDatabase::uncache(unsigned id) const
+{
+    if (auto cached{ m_cached.find(id) }; cached != m_cached.end())
+    {
+        m_cachedBytes -= cachedBytes(*cached->second);
+        m_recent.erase(cached->second);
+        m_cached.erase(cached);
+    }
+}
+
+std::vector<EmployeeRecord> BoundedEmployeeDatabase::addedRecords(Changes const &changes) const
+{
+    std::vector<EmployeeRecord> added;
+
+    for (auto const &[id, record] : changes)
+    {
+        if (record && !m_file.contains(id))
+        {
+            added.push_back(*record);
+        }
+    }
+
+    std::ranges::sort(added, {}, &EmployeeRecord::id);
+    return added;
+}
+
+bool BoundedEmployeeDatabase::save()
+{
+    std::lock_guard lock{ m_mutex };
+
+    if (m_changeCount == m_savedChanges)
+    {
+        return true;
+    }
+
+    std::filesystem::path temporary{ m_path };
+    temporary += ".tmp";
+
+    int fd{ ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644) };
+    bool written{ fd >= 0 };
+
+    if (written)
+    {
+        BulkWriter writer{ fd };
+        writer.println("{}", csvHeader);
+
+        auto writeRecord{ [&writer](EmployeeRecord const &record)
+            {
+                writer.println("{},{},{},{}", record.id, record.name, record.password, roleInfo(record.role).name);
+            } };
+
+        // Unchanged lines are copied as they are, changed ones rewritten in
+        // place and removed ones left out.
+        forEachRecord<1>(m_file.records(), [&](std::string_view line, std::span<std::string_view const> fields)
+            {
+                unsigned id{};
+                auto changed{ parseEmployeeID(fields[0], id) ? m_changes.find(id) : m_changes.end() };
+
+                if (changed == m_changes.end() || !m_file.isFirst(id, line))
+                {
+                    writer.println("{}", line);
+                }
+                else if (changed->second)
+                {
+                    writeRecord(*changed->second);
+                }
+
+                return true;
+            });
+
+        for (EmployeeRecord const &added : addedRecords(m_changes))
+        {
+            writeRecord(added);
+        }
+
+        writer.flush();
+        written = !writer.failed() && ::fsync(fd) == 0;
+        ::close(fd);
+    }
+
+    if (!written)
+    {
+        std::println(stderr, "Failed to save employee database to {}: {}", temporary.string(), std::strerror(errno));
+        return false;
+    }
+
+    auto publish{ [&]
+        {
+            std::error_code error;
+            std::filesystem::rename(temporary, m_path, error);
+
+            if (error)
+            {
+                std::println(stderr, "Failed to replace employee database {}: {}", m_path.string(), error.message());
+            }
+
+            return !error;
+        } };
+
+    if (!(m_log ? m_log->checkpoint(m_log->mark(), stampOf(temporary), publish) : publish()))
+    {
+        std::error_code error;
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    // Cached records are unchanged by saving, only where they come from moves.
+    m_file = EmployeeFileIndex{ m_path };
+    m_changes.clear();
+    m_savedChanges = m_changeCount;
+
+    return true;
+}
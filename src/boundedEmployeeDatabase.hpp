@@ -0,0 +1,231 @@
+//******************************************************************************
+//File Name: boundedEmployeeDatabase.hpp
+//Description: Employee database caching a bounded number of records from disk.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef BOUNDED_EMPLOYEE_DATABASE_HPP
+#define BOUNDED_EMPLOYEE_DATABASE_HPP
+
+#include "employeeFileIndex.hpp"
+#include "employeeLoader.hpp"
+#include "employeeQuery.hpp"
+#include "employeeStore.hpp"
+#include "employees.hpp"
+#include "fieldScanner.hpp"
+#include "operationLog.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+// Employee database for rosters too large to load, which never holds more
+// than a memory budget's worth of parsed records.  The CSV database is only
+// indexed by ID (see EmployeeFileIndex), records are parsed from the file
+// when asked for, and the most recently used are kept in a least recently
+// used cache whose footprint stays within the budget.
+//
+// Changes are kept apart from the file, as whole records or removals, until
+// `save` rewrites the file with them, and are logged like EmployeeDatabase's
+// meanwhile.  They are not counted against the budget.
+//
+// The interface mirrors the parts of SharedEmployeeDatabase and
+// EmployeeDatabase sessions use, so they may run against either.  There is
+// only one version: reads see every change as soon as it is made, and
+// writers take turns so each sees consistent contents.  Every member may be
+// used from any thread, except `save`.
+class BoundedEmployeeDatabase
+{
+public:
+    // Counters of the record cache since construction.
+    struct CacheStatistics
+    {
+        std::uint64_t hits;         // Lookups answered without parsing the file.
+        std::uint64_t misses;       // Lookups that parsed a record from the file.
+        std::uint64_t evictions;
+        std::size_t records;        // Records cached now.
+        std::size_t bytes;          // Their estimated footprint.
+        std::size_t budget;
+        std::size_t indexBytes;     // Held by the file index, outside the budget.
+        std::size_t changes;        // Changed records awaiting `save`.
+    };
+
+    // Indexes the database at `path`, caching at most `memoryBudget` bytes of
+    // records.  A missing database is reported and treated as empty.
+    BoundedEmployeeDatabase(std::filesystem::path path, std::size_t memoryBudget);
+
+    BoundedEmployeeDatabase(BoundedEmployeeDatabase const &) = delete;
+    BoundedEmployeeDatabase &operator=(BoundedEmployeeDatabase const &) = delete;
+
+    // As SharedEmployeeDatabase::read, but the database is its only version.
+    BoundedEmployeeDatabase const *read() const { return this; }
+
+    // Calls `commit(*this)` while holding the writers' turn and returns its
+    // result, see SharedEmployeeDatabase::write.
+    template<typename Commit>
+    decltype(auto) write(Commit &&commit)
+    {
+        std::lock_guard lock{ m_writeMutex };
+        return commit(*this);
+    }
+
+    // As EmployeeDatabase::attachLog.
+    void attachLog(OperationLog *log);
+
+    // As EmployeeDatabase::apply.
+    bool apply(LogRecord const &record) { return applyLogRecord(*this, record); }
+
+    // Employee with `id`, or nullopt if not present.  Records not cached are
+    // parsed from the file and cached, evicting the least recently used.
+    std::optional<EmployeeRecord> find(unsigned id) const;
+
+    bool contains(unsigned id) const;
+
+    // Modifiers as in EmployeeDatabase, each logged.
+    void add(EmployeeBuilder const &params);
+    void remove(unsigned id);
+    void changeID(unsigned id, unsigned newID);
+    void rename(unsigned id, std::string_view name);
+    void changePassword(unsigned id, std::string_view password);
+    void changeRole(unsigned id, Role role);
+
+    // IDs of the employees named exactly `name`, in database order.
+    std::vector<unsigned> findByName(std::string_view name) const;
+
+    // Calls `visit(employee)` for every employee whose name starts with
+    // `prefix`, in database order, as no index by name is kept.
+    template<typename Visit>
+    void forEachWithNamePrefix(std::string_view prefix, Visit &&visit) const
+    {
+        scan([prefix](unsigned, std::string_view name, Role) { return name.starts_with(prefix); },
+             std::forward<Visit>(visit));
+    }
+
+    // Calls `visit(employee)` for every employee in database order: the file's
+    // records with changes applied, then added employees in order of ID.
+    // Scanning bypasses the cache, so it neither counts nor evicts.
+    template<typename Visit>
+    void forEach(Visit &&visit) const
+    {
+        scan([](unsigned, std::string_view, Role) { return true; }, std::forward<Visit>(visit));
+    }
+
+    // Employees matching `query`, in order of ID, from a scan of the file as
+    // no index but the file's by ID is kept.
+    std::vector<EmployeeRecord> select(EmployeeQuery const &query) const;
+
+    std::size_t size() const;
+
+    CacheStatistics cacheStatistics() const;
+
+    // Rewrites the database with every change, checkpointing the attached log
+    // as BackgroundSaver does, and indexes the new file.  Returns false on
+    // failure, keeping the changes.  No other member may be in use meanwhile.
+    bool save();
+
+private:
+    using Changes = std::unordered_map<unsigned, std::optional<EmployeeRecord>>;
+
+    // Latest record with `id` without touching the cache, m_mutex held.
+    std::optional<EmployeeRecord> current(unsigned id) const;
+
+    bool containsLocked(unsigned id) const;
+
+    // Records `record` as changed, or `id` as removed when it is nullopt,
+    // m_mutex held.
+    void change(unsigned id, std::optional<EmployeeRecord> record);
+
+    void cache(EmployeeRecord const &record) const;
+    void uncache(unsigned id) const;
+
+    // Calls `visit(employee)` for every employee that `matches(id, name, role)`,
+    // with changes as they were when the scan started.  The file is scanned
+    // without holding m_mutex, and records are only built for matches.
+    template<typename Matches, typename Visit>
+    void scan(Matches &&matches, Visit &&visit) const
+    {
+        Changes changes;
+
+        {
+            std::lock_guard lock{ m_mutex };
+            changes = m_changes;
+        }
+
+        forEachRecord(m_file.records(), [&](std::string_view line, std::span<std::string_view const> fields)
+            {
+                std::optional<EmployeeBuilder> params{ parseEmployee(fields) };
+
+                // Malformed records are skipped, as the file is never loaded
+                // as a whole to report them.
+                if (!params)
+                {
+                    return true;
+                }
+
+                if (auto changed{ changes.find(params->id) };
+                    changed != changes.end() && m_file.isFirst(params->id, line))
+                {
+                    if (EmployeeRecord const *record{ changed->second ? &*changed->second : nullptr };
+                        record && matches(record->id, record->name, record->role))
+                    {
+                        visit(*record);
+                    }
+
+                    return true;
+                }
+
+                if (matches(params->id, params->name, params->role))
+                {
+                    visit(EmployeeRecord{ params->id, std::string{ params->name }, std::string{ params->password },
+                                          params->role });
+                }
+
+                return true;
+            });
+
+        for (EmployeeRecord const &added : addedRecords(changes))
+        {
+            if (matches(added.id, added.name, added.role))
+            {
+                visit(added);
+            }
+        }
+    }
+
+    // Records of `changes` not in the file, sorted by ID.
+    std::vector<EmployeeRecord> addedRecords(Changes const &changes) const;
+
+    std::filesystem::path m_path;
+    std::size_t m_budget;
+
+    std::mutex m_writeMutex;        // Held by writers for their turn.
+    mutable std::mutex m_mutex;     // Guards everything below.
+
+    EmployeeFileIndex m_file;
+    Changes m_changes;
+    std::size_t m_size;
+    std::uint64_t m_changeCount{};
+    std::uint64_t m_savedChanges{};
+    OperationLog *m_log{ nullptr };
+
+    // Most recently used first, found by ID through m_cached.
+    mutable std::list<EmployeeRecord> m_recent;
+    mutable std::unordered_map<unsigned, std::list<EmployeeRecord>::iterator> m_cached;
+    mutable std::size_t m_cachedBytes{};
+    mutable std::uint64_t m_hits{};
+    mutable std::uint64_t m_misses{};
+    mutable std::uint64_t m_evictions{};
+};
+
+#endif
@@ -0,0 +1,65 @@
+//******************************************************************************
+//File Name: bulkWriter.cpp
+//Description: Implementation for BulkWriter object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "bulkWriter.hpp"
+#include "terminal.hpp"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+
+
+bool useBulkOutput(OutputMode mode)
+{
+    switch (mode)
+    {
+        case OutputMode::automatic:
+            return !outputIsTerminal();
+        case OutputMode::line:
+            return false;
+        case OutputMode::bulk:
+            return true;
+    }
+
+    return false;
+}
+
+BulkWriter::BulkWriter(int fd)
+: m_fd{ fd }
+{
+    // Leave room for the record that crosses the chunk boundary.
+    m_buffer.reserve(chunkSize + chunkSize / 4);
+
+    // Anything already printed through stdio must come first.
+    std::fflush(stdout);
+}
+
+void BulkWriter::flush()
+{
+    std::size_t written{};
+
+    while (written < m_buffer.size())
+    {
+        ssize_t result{ ::write(m_fd, m_buffer.data() + written, m_buffer.size() - written) };
+
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            m_failed = true;
+            break;  // Drop the output, callers that care check failed().
+        }
+
+        written += static_cast<std::size_t>(result);
+    }
+
+    m_buffer.clear();
+}
@@ -0,0 +1,68 @@
+//******************************************************************************
+//File Name: bulkWriter.hpp
+//Description: Chunked, buffered output for large listings.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef BULK_WRITER_HPP
+#define BULK_WRITER_HPP
+
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <string>
+#include <utility>
+
+
+// How large listings are written to standard output.
+enum struct OutputMode
+{
+    automatic,  // Bulk when standard output is not a terminal, line otherwise.
+    line,       // One std::println per record.
+    bulk,       // Formatted into a BulkWriter and written in large chunks.
+};
+
+// Whether `mode` resolves to bulk output for the current standard output.
+bool useBulkOutput(OutputMode mode);
+
+// Formats into a reusable buffer and writes it to a file descriptor with a
+// single write call per chunk, rather than one write per line.
+class BulkWriter
+{
+public:
+    static constexpr std::size_t chunkSize{ std::size_t{ 1 } << 16 };
+
+    explicit BulkWriter(int fd);
+
+    // Anything still buffered is written on destruction.
+    ~BulkWriter() { flush(); }
+
+    BulkWriter(BulkWriter const &) = delete;
+    BulkWriter &operator=(BulkWriter const &) = delete;
+
+    template<typename... Args>
+    void println(std::format_string<Args...> format, Args &&...args)
+    {
+        std::format_to(std::back_inserter(m_buffer), format, std::forward<Args>(args)...);
+        m_buffer.push_back('\n');
+
+        if (m_buffer.size() >= chunkSize)
+        {
+            flush();
+        }
+    }
+
+    // Writes out everything buffered so far.
+    void flush();
+
+    // Whether any output has been dropped because a write failed.
+    bool failed() const { return m_failed; }
+
+private:
+    int m_fd;
+    std::string m_buffer;
+    bool m_failed{ false };
+};
+
+#endif
@@ -0,0 +1,66 @@
+//******************************************************************************
+//File Name: console.cpp
+//Description: Implementation for the standard and per thread consoles.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "console.hpp"
+#include "terminal.hpp"
+
+#include <cstdio>
+#include <iostream>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+class StandardConsole : public Console
+{
+public:
+    bool readLine(std::string &line) override
+    {
+        return static_cast<bool>(std::getline(std::cin, line));
+    }
+
+    void write(std::string_view text) override
+    {
+        // Through stdio, so it stays ordered with anything printed directly.
+        std::fwrite(text.data(), 1, text.size(), stdout);
+    }
+
+    void clear() override { clearTerminal(); }
+
+    bool isStandardOutput() const override { return true; }
+};
+
+StandardConsole standardConsole;
+
+thread_local Console *threadConsole{ &standardConsole };
+
+} // anonymous namespace
+
+Console &currentConsole()
+{
+    return *threadConsole;
+}
+
+ConsoleScope::ConsoleScope(Console &console)
+: m_previous{ threadConsole }
+{
+    threadConsole = &console;
+}
+
+ConsoleScope::~ConsoleScope()
+{
+    threadConsole = m_previous;
+}
+
+void consoleReadLine(std::string &line)
+{
+    if (!currentConsole().readLine(line))
+    {
+        throw ConsoleClosed{};
+    }
+}
@@ -0,0 +1,82 @@
+//******************************************************************************
+//File Name: console.hpp
+//Description: Per thread input and output for the interactive menus.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef CONSOLE_HPP
+#define CONSOLE_HPP
+
+#include <format>
+#include <string>
+#include <string_view>
+#include <utility>
+
+
+// Thrown by consoleReadLine when the console has no more input, which ends
+// the menus of the session using it.
+struct ConsoleClosed {};
+
+// Where the interactive menus read their input and write their output.  A
+// thread uses the standard console, std::cin and stdout, unless a session
+// console has been installed on it with ConsoleScope.
+class Console
+{
+public:
+    virtual ~Console() = default;
+
+    // Reads the next line without its newline, false when input has ended.
+    virtual bool readLine(std::string &line) = 0;
+
+    virtual void write(std::string_view text) = 0;
+
+    // Clears the screen, when the console is displayed on a terminal.
+    virtual void clear() = 0;
+
+    // Whether output goes to the process's standard output.
+    virtual bool isStandardOutput() const { return false; }
+};
+
+// Console of the calling thread.
+Console &currentConsole();
+
+// Installs `console` as the calling thread's console for the scope's lifetime.
+class ConsoleScope
+{
+public:
+    explicit ConsoleScope(Console &console);
+    ~ConsoleScope();
+
+    ConsoleScope(ConsoleScope const &) = delete;
+    ConsoleScope &operator=(ConsoleScope const &) = delete;
+
+private:
+    Console *m_previous;
+};
+
+template<typename... Args>
+void consolePrint(std::format_string<Args...> format, Args &&...args)
+{
+    currentConsole().write(std::format(format, std::forward<Args>(args)...));
+}
+
+template<typename... Args>
+void consolePrintln(std::format_string<Args...> format, Args &&...args)
+{
+    std::string text{ std::format(format, std::forward<Args>(args)...) };
+    text.push_back('\n');
+
+    currentConsole().write(text);
+}
+
+inline void consolePrintln()
+{
+    currentConsole().write("\n");
+}
+
+// Reads the next line of the current console into `line`, throws
+// ConsoleClosed when input has ended.
+void consoleReadLine(std::string &line);
+
+#endif
@@ -0,0 +1,553 @@
+//******************************************************************************
+//File Name: employeeDatabase.cpp
+//Description: Implementation for EmployeeDatabase object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "employeeDatabase.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <print>
+#include <string>
+#include <thread>
+#include <utility>
+
+
+void EmployeeDatabase::assign(EmployeeStore store)
+{
+    std::lock_guard lock{ m_modifyMutex };
+
+    m_store = std::move(store);
+    m_idIndex.clear();
+    m_idIndex.reserve(m_store.size());
+    m_nameIndex.clear();
+
+    std::array<std::vector<unsigned>, roleCount> byRole;
+
+    for (std::uint32_t position{}; position < m_store.size(); ++position)
+    {
+        if (!m_store.isLive(position))
+        {
+            continue;
+        }
+
+        unsigned id{ m_store.id(position) };
+
+        if (!m_idIndex.insert(id, position))
+        {
+            std::println("Duplicate employee ID {} found in database, only the first is used.", id);
+            m_store.erase(position);
+            continue;
+        }
+
+        m_nameIndex.insert(m_store.name(position), id);
+        byRole[static_cast<std::size_t>(m_store.role(position))].push_back(id);
+    }
+
+    // Stores are usually in ID order already, see buildOrderings.
+    for (std::size_t role{}; role < roleCount; ++role)
+    {
+        if (!std::ranges::is_sorted(byRole[role]))
+        {
+            std::ranges::sort(byRole[role]);
+        }
+
+        m_byRole[role].assign(byRole[role]);
+    }
+
+    // Built again when next needed.
+    m_orderings = {};
+    m_ordered.store(false, std::memory_order_relaxed);
+}
+
+EmployeeDatabase::Orderings const &EmployeeDatabase::orderings() const
+{
+    if (!m_ordered.load(std::memory_order_acquire))
+    {
+        std::lock_guard lock{ m_orderingsMutex };
+
+        if (!m_ordered.load(std::memory_order_relaxed))
+        {
+            buildOrderings();
+            m_ordered.store(true, std::memory_order_release);
+        }
+    }
+
+    return m_orderings;
+}
+
+void EmployeeDatabase::buildOrderings() const
+{
+    // Records are walked in store order, which is usually ID order already as
+    // databases are written that way, so each ordering is only sorted if not.
+    std::vector<unsigned> ids;
+    std::array<std::vector<TextKey>, roleCount> byRole;
+
+    ids.reserve(m_store.liveCount());
+
+    for (std::uint32_t position{}; position < m_store.size(); ++position)
+    {
+        if (m_store.isLive(position))
+        {
+            ids.push_back(m_store.id(position));
+            byRole[static_cast<std::size_t>(m_store.role(position))].push_back(titleKey(position));
+        }
+    }
+
+    if (!std::ranges::is_sorted(ids))
+    {
+        std::ranges::sort(ids);
+    }
+
+    m_orderings.byID.assign(ids);
+
+    // Titles are few, so each title's records are sorted by ID and the
+    // titles concatenated in order.
+    std::array<std::size_t, roleCount> roles;
+    std::iota(roles.begin(), roles.end(), std::size_t{});
+    std::ranges::sort(roles, {}, [](std::size_t role) { return roleTable[role].title; });
+
+    std::vector<TextKey> keys;
+    keys.reserve(ids.size());
+
+    for (std::size_t role : roles)
+    {
+        if (!std::ranges::is_sorted(byRole[role]))
+        {
+            std::ranges::sort(byRole[role]);
+        }
+
+        keys.insert(keys.end(), byRole[role].begin(), byRole[role].end());
+    }
+
+    m_orderings.byTitle.assign(keys);
+
+    // The name index already walks names in order, only each name's
+    // postings need sorting by ID.  Keys view the index's copy of the name,
+    // which lives as long as any employee has that name.
+    keys.clear();
+
+    m_nameIndex.forEachWithPrefix("", [&keys](std::string_view name, std::span<unsigned const> postings)
+        {
+            std::size_t first{ keys.size() };
+
+            for (unsigned id : postings)
+            {
+                keys.push_back({ name, id });
+            }
+
+            auto added{ keys.begin() + static_cast<std::ptrdiff_t>(first) };
+
+            if (!std::is_sorted(added, keys.end()))
+            {
+                std::sort(added, keys.end());
+            }
+        });
+
+    m_orderings.byName.assign(keys);
+}
+
+void EmployeeDatabase::insertOrdered(std::uint32_t position)
+{
+    if (m_ordered.load(std::memory_order_relaxed))
+    {
+        m_orderings.byID.insert(m_store.id(position));
+        m_orderings.byName.insert(nameKey(position));
+        m_orderings.byTitle.insert(titleKey(position));
+    }
+}
+
+void EmployeeDatabase::eraseOrdered(std::uint32_t position)
+{
+    if (m_ordered.load(std::memory_order_relaxed))
+    {
+        m_orderings.byID.erase(m_store.id(position));
+        m_orderings.byName.erase(nameKey(position));
+        m_orderings.byTitle.erase(titleKey(position));
+    }
+}
+
+std::size_t EmployeeDatabase::roleIndexMemoryUsage() const
+{
+    std::size_t bytes{};
+
+    for (IdBitmap const &ids : m_byRole)
+    {
+        bytes += ids.memoryUsage();
+    }
+
+    return bytes;
+}
+
+std::vector<Employee> EmployeeDatabase::select(EmployeeQuery const &query) const
+{
+    if (query.matchesNothing())
+    {
+        return {};
+    }
+
+    auto matches{ [this, &query](std::uint32_t position)
+        {
+            return query.matches(m_store.id(position), m_store.name(position), m_store.role(position));
+        } };
+
+    auto byID{ [this](std::uint32_t lhs, std::uint32_t rhs) { return m_store.id(lhs) < m_store.id(rhs); } };
+
+    // Each candidate from an index costs a hash lookup and a random access,
+    // so an index only wins when it narrows the search a lot.
+    constexpr std::size_t indexedFraction{ 16 };
+
+    std::vector<std::uint32_t> positions;
+
+    if (std::optional<std::string_view> name{ query.exactName() })
+    {
+        for (unsigned id : m_nameIndex.find(*name))
+        {
+            if (std::uint32_t position{ positionOf(id) }; matches(position))
+            {
+                positions.push_back(position);
+            }
+        }
+
+        std::ranges::sort(positions, byID);
+    }
+    else
+    {
+        unsigned lowest{ query.lowestID() };
+        unsigned highest{ query.highestID() };
+        std::size_t candidates{};
+
+        for (std::size_t role{}; role < roleCount; ++role)
+        {
+            if (query.allowsRole(Role{ static_cast<std::uint8_t>(role) }))
+            {
+                candidates += m_byRole[role].countInRange(lowest, highest);
+            }
+        }
+
+        // A required name prefix is looked up instead when it narrows the
+        // search further.
+        std::size_t limit{ std::min(candidates, size() / indexedFraction) };
+        std::optional<std::string_view> prefix{ query.namePrefix() };
+
+        if (prefix && m_nameIndex.countWithPrefix(*prefix, limit) <= limit)
+        {
+            m_nameIndex.forEachWithPrefix(*prefix, [&](std::string_view, std::span<unsigned const> ids)
+                {
+                    for (unsigned id : ids)
+                    {
+                        if (std::uint32_t position{ positionOf(id) }; matches(position))
+                        {
+                            positions.push_back(position);
+                        }
+                    }
+                });
+
+            std::ranges::sort(positions, byID);
+        }
+        else if (candidates > size() / indexedFraction)
+        {
+            positions = scan(query);
+        }
+        else
+        {
+            for (std::size_t role{}; role < roleCount; ++role)
+            {
+                if (!query.allowsRole(Role{ static_cast<std::uint8_t>(role) }))
+                {
+                    continue;
+                }
+
+                std::size_t merged{ positions.size() };
+                IdBitmap const &ids{ m_byRole[role] };
+
+                ids.forEach(ids.rank(lowest), ids.countInRange(lowest, highest), [&](unsigned id)
+                    {
+                        if (std::uint32_t position{ positionOf(id) }; matches(position))
+                        {
+                            positions.push_back(position);
+                        }
+                    });
+
+                std::ranges::inplace_merge(positions, positions.begin() + static_cast<std::ptrdiff_t>(merged), byID);
+            }
+        }
+    }
+
+    std::vector<Employee> employees;
+    employees.reserve(positions.size());
+
+    for (std::uint32_t position : positions)
+    {
+        employees.emplace_back(m_store, position);
+    }
+
+    return employees;
+}
+
+std::vector<std::uint32_t> EmployeeDatabase::scan(EmployeeQuery const &query) const
+{
+    // Small stores are not worth the cost of starting threads.
+    constexpr std::size_t minimumRangeSize{ 1 << 16 };
+
+    std::size_t threadCount{ std::clamp<std::size_t>(m_store.size() / minimumRangeSize,
+                                                     1, std::max(std::thread::hardware_concurrency(), 1u)) };
+    std::vector<std::vector<std::uint32_t>> found(threadCount);
+
+    auto byID{ [this](std::uint32_t lhs, std::uint32_t rhs) { return m_store.id(lhs) < m_store.id(rhs); } };
+
+    auto test{ [this, &query, &found, &byID, threadCount](std::size_t range)
+        {
+            auto first{ static_cast<std::uint32_t>(m_store.size() * range / threadCount) };
+            auto last{ static_cast<std::uint32_t>(m_store.size() * (range + 1) / threadCount) };
+            std::vector<std::uint32_t> &matches{ found[range] };
+
+            for (std::uint32_t position{ first }; position < last; ++position)
+            {
+                if (m_store.isLive(position)
+                    && query.matches(m_store.id(position), m_store.name(position), m_store.role(position)))
+                {
+                    matches.push_back(position);
+                }
+            }
+
+            // Stores are usually in ID order, so this is rarely needed.
+            if (!std::ranges::is_sorted(matches, byID))
+            {
+                std::ranges::sort(matches, byID);
+            }
+        } };
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(threadCount - 1);
+
+        for (std::size_t range{ 1 }; range < threadCount; ++range)
+        {
+            workers.emplace_back(test, range);
+        }
+
+        test(0);
+    }  // Workers join here.
+
+    std::vector<std::uint32_t> positions{ std::move(found[0]) };
+
+    for (std::size_t range{ 1 }; range < threadCount; ++range)
+    {
+        std::size_t merged{ positions.size() };
+        positions.insert(positions.end(), found[range].begin(), found[range].end());
+
+        // Ranges of a store in ID order follow each other, leaving nothing to merge.
+        if (merged > 0 && merged < positions.size() && byID(positions[merged], positions[merged - 1]))
+        {
+            std::ranges::inplace_merge(positions, positions.begin() + static_cast<std::ptrdiff_t>(merged), byID);
+        }
+    }
+
+    return positions;
+}
+
+bool EmployeeDatabase::apply(LogRecord const &record)
+{
+    return applyLogRecord(*this, record);
+}
+
+void EmployeeDatabase::recordChange(LogRecord const &record)
+{
+    if (m_log)
+    {
+        m_log->append(record);
+    }
+
+    if (m_observer)
+    {
+        m_observer(record);
+    }
+}
+
+Checkpoint EmployeeDatabase::checkpoint() const
+{
+    std::lock_guard lock{ m_modifyMutex };
+
+    return { m_store.share(), m_changes.load(std::memory_order_relaxed), m_log ? m_log->mark() : 0 };
+}
+
+std::optional<Employee> EmployeeDatabase::find(unsigned id) const
+{
+    std::uint32_t position{ positionOf(id) };
+
+    if (position == IdIndex::npos)
+    {
+        return std::nullopt;
+    }
+
+    return Employee{ m_store, position };
+}
+
+std::size_t EmployeeDatabase::countInIDRange(unsigned low, unsigned high) const
+{
+    if (low > high)
+    {
+        return 0;
+    }
+
+    // IDs up to and including `high`, without computing high + 1, which may
+    // overflow.
+    OrderedIndex<unsigned> const &byID{ orderings().byID };
+    std::size_t end{ byID.rank(high) + (contains(high) ? 1 : 0) };
+
+    return end - byID.rank(low);
+}
+
+std::optional<Employee> EmployeeDatabase::find(EmployeeHandle handle) const
+{
+    std::uint32_t position{ m_store.positionOf(handle) };
+
+    if (position == EmployeeStore::npos)
+    {
+        return std::nullopt;
+    }
+
+    return Employee{ m_store, position };
+}
+
+Employee EmployeeDatabase::add(EmployeeBuilder const &params)
+{
+    std::lock_guard lock{ m_modifyMutex };
+
+    std::uint32_t position{ m_store.append(params) };
+
+    m_idIndex.insert(params.id, position);
+    m_nameIndex.insert(m_store.name(position), params.id);
+    withRole(params.role).insert(params.id);
+    insertOrdered(position);
+
+    recordChange({ .operation = LogOperation::add, .id = params.id, .role = params.role,
+                  .name = params.name, .password = params.password });
+
+    m_changes.fetch_add(1, std::memory_order_release);
+
+    return { m_store, position };
+}
+
+void EmployeeDatabase::remove(unsigned id)
+{
+    std::lock_guard lock{ m_modifyMutex };
+
+    std::uint32_t position{ positionOf(id) };
+
+    eraseOrdered(position);
+    m_nameIndex.erase(m_store.name(position), id);
+    withRole(m_store.role(position)).erase(id);
+    m_idIndex.erase(id);
+    m_store.erase(position);
+
+    if (m_store.isSparse())
+    {
+        m_store.compact();
+
+        for (std::uint32_t moved{}; moved < m_store.size(); ++moved)
+        {
+            m_idIndex.assign(m_store.id(moved), moved);
+        }
+    }
+
+    recordChange({ .operation = LogOperation::remove, .id = id });
+
+    m_changes.fetch_add(1, std::memory_order_release);
+}
+
+void EmployeeDatabase::changeID(unsigned id, unsigned newID)
+{
+    std::lock_guard lock{ m_modifyMutex };
+
+    std::uint32_t position{ positionOf(id) };
+
+    m_idIndex.erase(id);
+    m_idIndex.insert(newID, position);
+    m_nameIndex.changeID(m_store.name(position), id, newID);
+    withRole(m_store.role(position)).erase(id);
+    withRole(m_store.role(position)).insert(newID);
+    eraseOrdered(position);
+    m_store.setID(position, newID);
+    insertOrdered(position);
+
+    recordChange({ .operation = LogOperation::changeID, .id = id, .newID = newID });
+
+    m_changes.fetch_add(1, std::memory_order_release);
+}
+
+void EmployeeDatabase::rename(unsigned id, std::string_view name)
+{
+    std::lock_guard lock{ m_modifyMutex };
+
+    std::uint32_t position{ positionOf(id) };
+
+    // Copy the new name first, it may view the store's own buffer.
+    std::string newName{ name };
+
+    // The ordering's key may view the name index's copy of the old name, so
+    // it goes first.
+    bool ordered{ m_ordered.load(std::memory_order_relaxed) };
+
+    if (ordered)
+    {
+        m_orderings.byName.erase(nameKey(position));
+    }
+
+    m_nameIndex.erase(m_store.name(position), id);
+    m_store.setName(position, newName);
+    m_nameIndex.insert(newName, id);
+
+    if (ordered)
+    {
+        m_orderings.byName.insert(nameKey(position));
+    }
+
+    recordChange({ .operation = LogOperation::rename, .id = id, .name = newName });
+
+    m_changes.fetch_add(1, std::memory_order_release);
+}
+
+void EmployeeDatabase::changePassword(unsigned id, std::string_view password)
+{
+    std::lock_guard lock{ m_modifyMutex };
+
+    std::string newPassword{ password };
+    m_store.setPassword(positionOf(id), newPassword);
+
+    recordChange({ .operation = LogOperation::changePassword, .id = id, .password = newPassword });
+
+    m_changes.fetch_add(1, std::memory_order_release);
+}
+
+void EmployeeDatabase::changeRole(unsigned id, Role role)
+{
+    std::lock_guard lock{ m_modifyMutex };
+
+    std::uint32_t position{ positionOf(id) };
+
+    bool ordered{ m_ordered.load(std::memory_order_relaxed) };
+
+    if (ordered)
+    {
+        m_orderings.byTitle.erase(titleKey(position));
+    }
+
+    withRole(m_store.role(position)).erase(id);
+    m_store.setRole(position, role);
+    withRole(role).insert(id);
+
+    if (ordered)
+    {
+        m_orderings.byTitle.insert(titleKey(position));
+    }
+
+    recordChange({ .operation = LogOperation::changeRole, .id = id, .role = role });
+
+    m_changes.fetch_add(1, std::memory_order_release);
+}
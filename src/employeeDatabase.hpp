@@ -0,0 +1,278 @@
+//******************************************************************************
+//File Name: employeeDatabase.hpp
+//Description: In memory employee store and its indexes.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef EMPLOYEE_DATABASE_HPP
+#define EMPLOYEE_DATABASE_HPP
+
+#include "employeeStore.hpp"
+#include "employeeQuery.hpp"
+#include "employees.hpp"
+#include "idBitmap.hpp"
+#include "idIndex.hpp"
+#include "nameIndex.hpp"
+#include "operationLog.hpp"
+#include "orderedIndex.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+// Orderings the database can be listed in, see EmployeeDatabase::forEachInOrder.
+enum struct EmployeeOrder : std::uint8_t
+{
+    id,
+    name,       // Equal names by ID.
+    title,      // Equal titles by ID.
+};
+
+// Consistent copy of the database, see EmployeeDatabase::checkpoint.
+struct Checkpoint
+{
+    EmployeeStore employees;        // Shares strings, see EmployeeStore::share.
+    std::uint64_t changes;          // changeCount() when taken.
+    std::uint64_t logPosition;      // End of the attached log when taken.
+};
+
+// Owns the employee store and keeps the indexes over it consistent.  All
+// modifications must go through this class so the indexes never go stale.
+//
+// Modifications are made by one thread at a time, which may read without
+// locking.  Other threads may only use `changeCount` and `checkpoint`.
+class EmployeeDatabase
+{
+public:
+    // Replaces the contents of the database, e.g. after loading from disk.
+    // When an ID appears more than once only the first record is indexed.
+    // Records already removed from `store` stay removed.
+    void assign(EmployeeStore store);
+
+    // Records every later modification in `log`, which must outlive the
+    // database, or stops recording when null.
+    void attachLog(OperationLog *log) { m_log = log; }
+
+    // Calls `observer(record)` for every later modification as it is made,
+    // so records arrive in the order the modifications were made, or stops
+    // when empty.  It runs on the modifying thread before changeCount()
+    // counts the modification.
+    void observeChanges(std::function<void(LogRecord const &)> observer) { m_observer = std::move(observer); }
+
+    // Performs a logged modification, returns false and changes nothing if it
+    // does not apply to the current contents, e.g. adding an existing ID.
+    bool apply(LogRecord const &record);
+
+    // Employee with `id`, or nullopt if not present.
+    std::optional<Employee> find(unsigned id) const;
+
+    bool contains(unsigned id) const { return m_idIndex.contains(id); }
+
+    // Employee `handle` refers to, or nullopt once removed.  Handles stay
+    // valid through every modification and in every copy of the database.
+    std::optional<Employee> find(EmployeeHandle handle) const;
+
+    // Adds a new employee, whose ID must not already be present.
+    Employee add(EmployeeBuilder const &params);
+
+    // Removes the employee with `id`, which must be present.  Compacts the
+    // store once removed records outnumber the rest, so positions and
+    // Employee objects from before a removal must not be used after it.
+    void remove(unsigned id);
+
+    // Changes the ID of an existing employee to an unused ID.
+    void changeID(unsigned id, unsigned newID);
+
+    // Renames an existing employee.
+    void rename(unsigned id, std::string_view name);
+
+    // Changes the password of an existing employee.
+    void changePassword(unsigned id, std::string_view password);
+
+    // Changes the role, and so the title, of an existing employee.
+    void changeRole(unsigned id, Role role);
+
+    // IDs of the employees named exactly `name`, in database order.
+    std::span<unsigned const> findByName(std::string_view name) const { return m_nameIndex.find(name); }
+
+    // Calls `visit(employee)` for every employee whose name starts with
+    // `prefix`, ordered by name.
+    template<typename Visit>
+    void forEachWithNamePrefix(std::string_view prefix, Visit &&visit) const
+    {
+        m_nameIndex.forEachWithPrefix(prefix, [this, &visit](std::string_view, std::span<unsigned const> ids)
+            {
+                for (unsigned id : ids)
+                {
+                    visit(*find(id));
+                }
+            });
+    }
+
+    // Calls `visit(employee)` for every employee in database order, streaming
+    // through the store's columns.
+    template<typename Visit>
+    void forEach(Visit &&visit) const
+    {
+        for (std::uint32_t position{}; position < m_store.size(); ++position)
+        {
+            if (m_store.isLive(position))
+            {
+                visit(Employee{ m_store, position });
+            }
+        }
+    }
+
+    // Calls `visit(employee)` for at most `limit` employees in `order`, after
+    // skipping the first `offset`, in O(log n + limit).  The first ordered
+    // listing of a database builds its orderings, in O(n) when the records
+    // are in ID order, and modifications maintain them from then on.
+    template<typename Visit>
+    void forEachInOrder(EmployeeOrder order, std::size_t offset, std::size_t limit, Visit &&visit) const
+    {
+        auto visitID{ [this, &visit](unsigned id) { visit(*find(id)); } };
+        auto visitKey{ [&visitID](TextKey const &key) { visitID(key.id); } };
+
+        switch (order)
+        {
+            case EmployeeOrder::id:
+                return orderings().byID.forEach(offset, limit, visitID);
+            case EmployeeOrder::name:
+                return orderings().byName.forEach(offset, limit, visitKey);
+            case EmployeeOrder::title:
+                return orderings().byTitle.forEach(offset, limit, visitKey);
+        }
+    }
+
+    // Whether the orderings are built, and builds them ahead of the first
+    // ordered listing.  Both are safe to call while others list the database.
+    bool isOrdered() const { return m_ordered.load(std::memory_order_acquire); }
+    void prepareOrderings() const { orderings(); }
+
+    // Number of employees with IDs from `low` to `high` inclusive, in O(log n).
+    std::size_t countInIDRange(unsigned low, unsigned high) const;
+
+    // As forEachInOrder by ID, restricted to IDs from `low` to `high` inclusive.
+    template<typename Visit>
+    void forEachInIDRange(unsigned low, unsigned high, std::size_t offset, std::size_t limit, Visit &&visit) const
+    {
+        std::size_t count{ countInIDRange(low, high) };
+
+        if (offset < count)
+        {
+            OrderedIndex<unsigned> const &byID{ orderings().byID };
+
+            byID.forEach(byID.rank(low) + offset, std::min(limit, count - offset),
+                         [this, &visit](unsigned id) { visit(*find(id)); });
+        }
+    }
+
+    std::size_t size() const { return m_store.liveCount(); }
+
+    // Number of employees with `role`, in O(1).
+    std::size_t countWithRole(Role role) const { return withRole(role).size(); }
+
+    // Calls `visit(employee)` for at most `limit` employees with `role` in
+    // order of ID, after skipping the first `offset`.  Only employees with
+    // the role are visited, from its bitmap.
+    template<typename Visit>
+    void forEachWithRole(Role role, std::size_t offset, std::size_t limit, Visit &&visit) const
+    {
+        withRole(role).forEach(offset, limit, [this, &visit](unsigned id) { visit(*find(id)); });
+    }
+
+    // Bytes held by the bitmaps of employees by role.
+    std::size_t roleIndexMemoryUsage() const;
+
+    // Employees matching `query`, in order of ID.  An exact name is looked up
+    // in the name index.  Otherwise the names starting with a required
+    // prefix, from the name index, or the employees of the allowed roles
+    // within the query's ID range, from the role bitmaps, are tested,
+    // whichever are fewer, when they are few enough.  Otherwise every record
+    // is tested, see `scan`.
+    std::vector<Employee> select(EmployeeQuery const &query) const;
+
+    // Number of modifications made so far.
+    std::uint64_t changeCount() const { return m_changes.load(std::memory_order_acquire); }
+
+    // Copies the database as of the last completed modification, along with
+    // the matching position in the attached log.
+    Checkpoint checkpoint() const;
+
+private:
+    // Key of the name and title orderings, viewing the store's string or
+    // the role's title, with the ID breaking ties.
+    struct TextKey
+    {
+        std::string_view text;
+        unsigned id;
+
+        auto operator<=>(TextKey const &) const = default;
+    };
+
+    std::uint32_t positionOf(unsigned id) const { return m_idIndex.find(id); }
+
+    IdBitmap const &withRole(Role role) const { return m_byRole[static_cast<std::size_t>(role)]; }
+    IdBitmap &withRole(Role role) { return m_byRole[static_cast<std::size_t>(role)]; }
+
+    TextKey nameKey(std::uint32_t position) const { return { m_store.name(position), m_store.id(position) }; }
+    TextKey titleKey(std::uint32_t position) const
+    {
+        return { roleInfo(m_store.role(position)).title, m_store.id(position) };
+    }
+
+    struct Orderings
+    {
+        OrderedIndex<unsigned> byID;
+        OrderedIndex<TextKey> byName;
+        OrderedIndex<TextKey> byTitle;
+    };
+
+    // The orderings, built on first use as only listing needs them.  Safe to
+    // call from several threads while the database is not being modified.
+    Orderings const &orderings() const;
+
+    // Builds the orderings from the store and the name index, in linear time
+    // when the store is in ID order.
+    void buildOrderings() const;
+
+    // Positions of the records matching `query`, in order of ID.  The store
+    // is split into one range of positions per hardware thread, each tested
+    // into its own buffer, and the buffers are merged in order of ID.
+    std::vector<std::uint32_t> scan(EmployeeQuery const &query) const;
+
+    // Passes a modification to the attached log and observer.
+    void recordChange(LogRecord const &record);
+
+    // Adds or removes the record at `position` in every ordering, if built.
+    void insertOrdered(std::uint32_t position);
+    void eraseOrdered(std::uint32_t position);
+
+    EmployeeStore m_store;
+    IdIndex m_idIndex;
+    NameIndex m_nameIndex;
+    std::array<IdBitmap, roleCount> m_byRole;  // IDs of the employees with each role.
+    OperationLog *m_log{ nullptr };
+    std::function<void(LogRecord const &)> m_observer;
+
+    mutable Orderings m_orderings;
+    mutable std::mutex m_orderingsMutex;    // Held while building m_orderings.
+    mutable std::atomic<bool> m_ordered{};  // Whether m_orderings is built.
+
+    // Held while modifying, so checkpoints never see a partial modification.
+    mutable std::mutex m_modifyMutex;
+    std::atomic<std::uint64_t> m_changes{};
+};
+
+#endif
@@ -0,0 +1,111 @@
+//******************************************************************************
+//File Name: employeeFileIndex.cpp
+//Description: Implementation for EmployeeFileIndex object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "employeeFileIndex.hpp"
+#include "employeeLoader.hpp"
+#include "fieldScanner.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+
+EmployeeFileIndex::EmployeeFileIndex(std::filesystem::path const &path)
+: m_mapping{ path }
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    std::string_view contents{ m_mapping.contents() };
+    std::size_t headerEnd{ contents.find('\n') };
+
+    if (headerEnd == std::string_view::npos)
+    {
+        return;
+    }
+
+    // Only the ID field of each line is looked at.  Lines whose ID does not
+    // parse are left for the full load to report.
+    for (std::size_t position{ headerEnd + 1 }; position < contents.size();)
+    {
+        std::size_t end{ std::min(contents.find('\n', position), contents.size()) };
+        std::string_view line{ contents.substr(position, end - position) };
+        unsigned id{};
+
+        if (parseEmployeeID(line.substr(0, line.find(',')), id))
+        {
+            m_lines.push_back({ position, id });
+        }
+
+        position = end + 1;
+    }
+
+    // Databases are usually written in ID order, so sorting is rarely needed.
+    // The sort is stable and keeps the first of any repeated ID, as loading does.
+    auto byID{ [](Line const &lhs, Line const &rhs) { return lhs.id < rhs.id; } };
+
+    if (!std::ranges::is_sorted(m_lines, byID))
+    {
+        std::ranges::stable_sort(m_lines, byID);
+    }
+
+    auto repeated{ std::ranges::unique(m_lines, {}, &Line::id) };
+    m_lines.erase(repeated.begin(), repeated.end());
+}
+
+EmployeeFileIndex::Line const *EmployeeFileIndex::lineOf(unsigned id) const
+{
+    auto found{ std::ranges::lower_bound(m_lines, id, {}, &Line::id) };
+
+    return found != m_lines.end() && found->id == id ? &*found : nullptr;
+}
+
+std::optional<Employee> EmployeeFileIndex::find(unsigned id, EmployeeStore &store) const
+{
+    std::optional<std::string_view> line{ findLine(id) };
+
+    if (!line)
+    {
+        return std::nullopt;
+    }
+
+    store.borrowFrom(m_mapping.contents());
+    makeEmployee(*line, store, true);
+
+    return Employee{ store, store.size() - 1 };
+}
+
+std::optional<std::string_view> EmployeeFileIndex::findLine(unsigned id) const
+{
+    Line const *line{ lineOf(id) };
+
+    if (!line)
+    {
+        return std::nullopt;
+    }
+
+    std::string_view contents{ m_mapping.contents() };
+    std::size_t end{ std::min(contents.find('\n', line->offset), contents.size()) };
+
+    return contents.substr(line->offset, end - line->offset);
+}
+
+std::string_view EmployeeFileIndex::records() const
+{
+    std::string_view contents{ m_mapping.contents() };
+    std::size_t headerEnd{ contents.find('\n') };
+
+    return headerEnd == std::string_view::npos ? std::string_view{} : contents.substr(headerEnd + 1);
+}
+
+bool EmployeeFileIndex::isFirst(unsigned id, std::string_view line) const
+{
+    Line const *first{ lineOf(id) };
+
+    return first && line.data() == m_mapping.contents().data() + first->offset;
+}
@@ -0,0 +1,71 @@
+//******************************************************************************
+//File Name: employeeFileIndex.hpp
+//Description: Index of the CSV database by ID, for parsing records on demand.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef EMPLOYEE_FILE_INDEX_HPP
+#define EMPLOYEE_FILE_INDEX_HPP
+
+#include "employeeStore.hpp"
+#include "employees.hpp"
+#include "mappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+
+// Maps the CSV database and records where each employee's line starts,
+// sorted by ID, without parsing anything else.  Building it is a single
+// sequential scan costing 16 bytes per employee, far less than loading the
+// database, and any one record can then be parsed when it is first needed.
+// The index is never modified, so any number of threads may use it.
+class EmployeeFileIndex
+{
+public:
+    // Maps and indexes the database at `path`, check `isOpen()` for success.
+    explicit EmployeeFileIndex(std::filesystem::path const &path);
+
+    bool isOpen() const { return m_mapping.isOpen(); }
+
+    bool contains(unsigned id) const { return lineOf(id) != nullptr; }
+
+    // Parses the record with `id` into `store`, viewing its fields in the
+    // mapping, or returns nullopt if there is none.  As when loading, only
+    // the first record with an ID counts, and malformed records exit.
+    std::optional<Employee> find(unsigned id, EmployeeStore &store) const;
+
+    // Line, without its newline, of the record with `id`, or nullopt.
+    std::optional<std::string_view> findLine(unsigned id) const;
+
+    // Every record of the database, after its header, in file order.
+    std::string_view records() const;
+
+    // Whether `line`, within records(), is the one findLine(id) returns rather
+    // than a later record repeating its ID.
+    bool isFirst(unsigned id, std::string_view line) const;
+
+    std::size_t size() const { return m_lines.size(); }
+
+    // Bytes held by the index itself, not counting the mapping.
+    std::size_t memoryUsage() const { return m_lines.capacity() * sizeof(Line); }
+
+private:
+    struct Line
+    {
+        std::uint64_t offset;
+        unsigned id;
+    };
+
+    Line const *lineOf(unsigned id) const;
+
+    MappedFile m_mapping;
+    std::vector<Line> m_lines;
+};
+
+#endif
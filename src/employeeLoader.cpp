@@ -0,0 +1,291 @@
+//******************************************************************************
+//File Name: employeeLoader.cpp
+//Description: Implementation for loading employees from the CSV database.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "employeeLoader.hpp"
+#include "employeeStore.hpp"
+#include "fieldScanner.hpp"
+#include "mappedFile.hpp"
+#include "roles.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+[[noreturn]]
+void invalidInput(std::string_view line)
+{
+    std::println("Invalid input encountered!");
+    std::println("Found: {}", line);
+    std::exit(1);
+}
+
+// Returns the line starting at `position` without its newline, and advances
+// `position` past the newline.
+std::string_view nextLine(std::string_view contents, std::size_t &position)
+{
+    std::size_t end{ contents.find('\n', position) };
+
+    if (end == std::string_view::npos)
+    {
+        end = contents.size();
+    }
+
+    std::string_view line{ contents.substr(position, end - position) };
+    position = end + 1;
+
+    return line;
+}
+
+// Appends a record built from the fields of one line to `store`, returns false
+// on malformed input rather than exiting so it may be used from worker threads.
+bool tryAppendEmployee(std::span<std::string_view const> fields, EmployeeStore &store, bool borrowFields)
+{
+    std::optional<EmployeeBuilder> params{ parseEmployee(fields) };
+
+    if (!params)
+    {
+        return false;
+    }
+
+    params->borrowFields = borrowFields;
+    store.append(*params);
+    return true;
+}
+
+// Records parsed from one newline aligned chunk of the database.  Parsing
+// stops at the first malformed line, which is kept for the diagnostic.
+struct ParsedChunk
+{
+    EmployeeStore employees;
+    std::optional<std::string_view> invalidLine;
+};
+
+// Parses `chunk`, which must lie within `mapping`, into records that borrow
+// their fields from `mapping`.
+ParsedChunk parseChunk(std::string_view chunk, std::string_view mapping)
+{
+    ParsedChunk parsed;
+    parsed.employees.borrowFrom(mapping);
+
+    forEachRecord(chunk, [&parsed](std::string_view line, std::span<std::string_view const> fields)
+        {
+            if (!tryAppendEmployee(fields, parsed.employees, true))
+            {
+                parsed.invalidLine = line;
+                return false;
+            }
+
+            return true;
+        });
+
+    return parsed;
+}
+
+// Splits `body` into at most `count` chunks of roughly equal size, each
+// ending just after a newline so that no record straddles two chunks.
+std::vector<std::string_view> splitIntoChunks(std::string_view body, std::size_t count)
+{
+    std::vector<std::string_view> chunks;
+    std::size_t begin{};
+
+    for (std::size_t i{ 1 }; i <= count && begin < body.size(); ++i)
+    {
+        std::size_t end{ std::max(body.size() * i / count, begin) };
+        end = i == count ? body.size() : body.find('\n', end);
+        end = end == std::string_view::npos ? body.size() : end + 1;
+
+        chunks.push_back(body.substr(begin, end - begin));
+        begin = end;
+    }
+
+    return chunks;
+}
+
+// Maps the database, returning the records following the CSV header, or
+// nullopt if the database could not be mapped.
+std::optional<std::string_view> mapDatabase(std::filesystem::path const &pathToCSV, MappedFile &mapping)
+{
+    if (!std::filesystem::exists(pathToCSV))
+    {
+        std::println("Employee database not found at {}", pathToCSV.string());
+        return std::nullopt;
+    }
+
+    mapping = MappedFile{ pathToCSV };
+
+    if (!mapping.isOpen())
+    {
+        std::println("Failed to map employee database file, {}", pathToCSV.string());
+        return std::nullopt;
+    }
+
+    std::string_view contents{ mapping.contents() };
+    std::size_t position{};
+
+    nextLine(contents, position);  // Skip CSV header.
+
+    return contents.substr(std::min(position, contents.size()));
+}
+
+} // anonymous namespace
+
+std::optional<EmployeeBuilder> parseEmployee(std::span<std::string_view const> fields)
+{
+    if (fields.size() != recordFieldCount || !isValidField(fields[1]) || !isValidField(fields[2]))
+    {
+        return std::nullopt;
+    }
+
+    auto role{ parseRole(fields[3]) };
+
+    if (!role)
+    {
+        return std::nullopt;
+    }
+
+    EmployeeBuilder params{ .id = 0, .name{ fields[1] }, .password{ fields[2] }, .role = *role };
+
+    if (!parseEmployeeID(fields[0], params.id))
+    {
+        return std::nullopt;
+    }
+
+    return params;
+}
+
+void makeEmployee(std::string_view line, EmployeeStore &store, bool borrowFields)
+{
+    bool valid{ false };
+
+    forEachRecord(line, [&](std::string_view, std::span<std::string_view const> fields)
+        {
+            valid = tryAppendEmployee(fields, store, borrowFields);
+            return false;  // Only the first line is considered.
+        });
+
+    if (!valid)
+    {
+        invalidInput(line);
+    }
+}
+
+EmployeeStore populateEmployeesFromFile(std::filesystem::path pathToCSV)
+{
+    EmployeeStore employees;
+
+    if (!std::filesystem::exists(pathToCSV))
+    {
+        std::println("Employee database not found at {}", pathToCSV.string());
+        return employees;
+    }
+
+    std::fstream file{ pathToCSV };
+
+    if (!file.is_open())
+    {
+        std::println("Failed to open employee database file, {}", pathToCSV.string());
+        return employees;
+    }
+
+    std::string line;
+    std::getline(file, line);  // Skip CSV header.
+
+    while (std::getline(file, line))
+    {
+        makeEmployee(line, employees);
+    }
+
+    return employees;
+}
+
+EmployeeStore populateEmployeesFromMapping(std::filesystem::path pathToCSV, MappedFile &mapping)
+{
+    auto body{ mapDatabase(pathToCSV, mapping) };
+
+    if (!body)
+    {
+        return {};
+    }
+
+    ParsedChunk parsed{ parseChunk(*body, mapping.contents()) };
+
+    if (parsed.invalidLine)
+    {
+        invalidInput(*parsed.invalidLine);
+    }
+
+    return std::move(parsed.employees);
+}
+
+EmployeeStore populateEmployeesInParallel(std::filesystem::path pathToCSV, MappedFile &mapping)
+{
+    auto body{ mapDatabase(pathToCSV, mapping) };
+
+    if (!body)
+    {
+        return {};
+    }
+
+    // Small databases are not worth the cost of starting threads.
+    constexpr std::size_t minimumChunkSize{ 1 << 20 };
+
+    std::size_t threadCount{ std::clamp<std::size_t>(body->size() / minimumChunkSize,
+                                                     1, std::max(std::thread::hardware_concurrency(), 1u)) };
+
+    std::vector<std::string_view> chunks{ splitIntoChunks(*body, threadCount) };
+    std::vector<ParsedChunk> parsed(chunks.size());
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(chunks.size());
+
+        for (std::size_t i{}; i < chunks.size(); ++i)
+        {
+            workers.emplace_back([&parsed, &chunks, &mapping, i]()
+                { parsed[i] = parseChunk(chunks[i], mapping.contents()); });
+        }
+    }  // Workers join here.
+
+    // Chunks are in file order, so the first invalid line found is also the
+    // first invalid line in the file, matching the sequential loaders.
+    std::size_t total{};
+
+    for (ParsedChunk const &chunk : parsed)
+    {
+        if (chunk.invalidLine)
+        {
+            invalidInput(*chunk.invalidLine);
+        }
+
+        total += chunk.employees.size();
+    }
+
+    EmployeeStore employees;
+    employees.borrowFrom(mapping.contents());
+    employees.reserve(total);
+
+    for (ParsedChunk &chunk : parsed)
+    {
+        employees.append(std::move(chunk.employees));
+    }
+
+    return employees;
+}
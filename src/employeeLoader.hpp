@@ -0,0 +1,55 @@
+//******************************************************************************
+//File Name: employeeLoader.hpp
+//Description: Functions for loading employees from the CSV database.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef EMPLOYEE_LOADER_HPP
+#define EMPLOYEE_LOADER_HPP
+
+#include "employeeStore.hpp"
+#include "mappedFile.hpp"
+
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+
+// First line of the CSV database, naming its columns.
+inline constexpr std::string_view csvHeader{ "Employee ID,Employee Name,Not so Secret Password,Title" };
+
+// Strategies for reading the employee database at startup.
+enum struct LoadMode
+{
+    stream,     // Read line by line, copying every field.
+    mapped,     // Memory map the file and view fields in place.
+    parallel,   // As mapped, but parse newline aligned chunks on every core.
+    lazy,       // Index IDs only and sign users in from single records while
+                // the database loads in parallel in the background.
+};
+
+// Parses the fields of one CSV line, see forEachRecord, into parameters that
+// view them, or returns nullopt if they are malformed.
+std::optional<EmployeeBuilder> parseEmployee(std::span<std::string_view const> fields);
+
+// Parses one CSV line into a record appended to `store`, exits on malformed
+// input.  When `borrowFields` is set the name and password are referenced in
+// the store's borrowed buffer, which must contain `line`, rather than copied.
+void makeEmployee(std::string_view line, EmployeeStore &store, bool borrowFields = false);
+
+// Reads the database with std::fstream, every record owns its fields.
+EmployeeStore populateEmployeesFromFile(std::filesystem::path pathToCSV);
+
+// Memory maps the database into `mapping` and parses directly out of the
+// mapped region.  Records view their name and password in the mapping until
+// they are modified, so `mapping` must outlive the returned records.
+EmployeeStore populateEmployeesFromMapping(std::filesystem::path pathToCSV, MappedFile &mapping);
+
+// As populateEmployeesFromMapping, but splits the mapping into newline aligned
+// chunks that are parsed concurrently, one per hardware thread.  Records are
+// returned in file order and the first malformed line in the file is reported.
+EmployeeStore populateEmployeesInParallel(std::filesystem::path pathToCSV, MappedFile &mapping);
+
+#endif
@@ -0,0 +1,401 @@
+//******************************************************************************
+//File Name: employeeQuery.cpp
+//Description: Implementation for EmployeeQuery object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "employeeQuery.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <system_error>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+struct Token
+{
+    enum struct Kind : std::uint8_t
+    {
+        word,
+        quoted,     // Text between quotes, without them.
+        symbol,     // =, !=, <, <=, > or >=.
+    };
+
+    Kind kind;
+    std::string_view text;
+};
+
+constexpr std::string_view symbolCharacters{ "=!<>" };
+constexpr std::array<std::string_view, 6> comparisons{ "=", "!=", "<", "<=", ">", ">=" };
+
+// Splits `text` into tokens, or returns false and sets `error`.
+bool tokenize(std::string_view text, std::vector<Token> &tokens, std::string_view &error)
+{
+    std::size_t position{};
+
+    while (true)
+    {
+        position = text.find_first_not_of(" \t", position);
+
+        if (position == std::string_view::npos)
+        {
+            return true;
+        }
+
+        char first{ text[position] };
+
+        if (first == '\'' || first == '"')
+        {
+            std::size_t end{ text.find(first, position + 1) };
+
+            if (end == std::string_view::npos)
+            {
+                error = "unterminated quote";
+                return false;
+            }
+
+            tokens.push_back({ Token::Kind::quoted, text.substr(position + 1, end - position - 1) });
+            position = end + 1;
+        }
+        else if (symbolCharacters.contains(first))
+        {
+            std::size_t length{ position + 1 < text.size() && text[position + 1] == '=' ? 2u : 1u };
+            std::string_view symbol{ text.substr(position, length) };
+
+            if (std::ranges::find(comparisons, symbol) == comparisons.end())
+            {
+                error = "unknown comparison";
+                return false;
+            }
+
+            tokens.push_back({ Token::Kind::symbol, symbol });
+            position += length;
+        }
+        else
+        {
+            std::size_t end{ std::min(text.find_first_of(" \t'\"=!<>", position), text.size()) };
+
+            tokens.push_back({ Token::Kind::word, text.substr(position, end - position) });
+            position = end;
+        }
+    }
+}
+
+// Reads tokens in order, for the recursive descent in EmployeeQuery::compile.
+class TokenReader
+{
+public:
+    explicit TokenReader(std::vector<Token> const &tokens)
+    : m_tokens{ tokens }
+    {}
+
+    bool atEnd() const { return m_next == m_tokens.size(); }
+
+    // Consumes the next token if it is the keyword `keyword`, in any case.
+    bool acceptKeyword(std::string_view keyword)
+    {
+        if (atEnd() || m_tokens[m_next].kind != Token::Kind::word
+            || !std::ranges::equal(m_tokens[m_next].text, keyword, {},
+                                   [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); }))
+        {
+            return false;
+        }
+
+        ++m_next;
+        return true;
+    }
+
+    // Consumes the next token if it is a comparison, returning its text.
+    std::optional<std::string_view> acceptSymbol()
+    {
+        if (atEnd() || m_tokens[m_next].kind != Token::Kind::symbol)
+        {
+            return std::nullopt;
+        }
+
+        return m_tokens[m_next++].text;
+    }
+
+    // Consumes the next token if it is a word or quoted text.
+    std::optional<std::string_view> acceptText()
+    {
+        if (atEnd() || m_tokens[m_next].kind == Token::Kind::symbol)
+        {
+            return std::nullopt;
+        }
+
+        return m_tokens[m_next++].text;
+    }
+
+    // Consumes the next token if it is an unsigned number.
+    std::optional<unsigned> acceptID()
+    {
+        if (atEnd() || m_tokens[m_next].kind != Token::Kind::word)
+        {
+            return std::nullopt;
+        }
+
+        std::string_view text{ m_tokens[m_next].text };
+        unsigned id{};
+        auto [end, error]{ std::from_chars(text.data(), text.data() + text.size(), id) };
+
+        if (error != std::errc{} || end != text.data() + text.size())
+        {
+            return std::nullopt;
+        }
+
+        ++m_next;
+        return id;
+    }
+
+private:
+    std::vector<Token> const &m_tokens;
+    std::size_t m_next{};
+};
+
+// Role written as in the database, or as displayed.
+std::optional<Role> parseRoleOrTitle(std::string_view text)
+{
+    if (std::optional<Role> role{ parseRole(text) })
+    {
+        return role;
+    }
+
+    auto found{ std::ranges::find(roleTable, text, &RoleInfo::title) };
+
+    if (found == roleTable.end())
+    {
+        return std::nullopt;
+    }
+
+    return Role{ static_cast<std::uint8_t>(found - roleTable.begin()) };
+}
+
+} // anonymous namespace
+
+std::optional<EmployeeQuery> EmployeeQuery::compile(std::string_view text, std::string_view &error)
+{
+    std::vector<Token> tokens;
+
+    if (!tokenize(text, tokens, error))
+    {
+        return std::nullopt;
+    }
+
+    if (tokens.empty())
+    {
+        error = "empty query";
+        return std::nullopt;
+    }
+
+    EmployeeQuery query;
+    TokenReader reader{ tokens };
+
+    auto narrow{ [&query](unsigned lowest, unsigned highest)
+        {
+            query.m_lowestID = std::max(query.m_lowestID, lowest);
+            query.m_highestID = std::min(query.m_highestID, highest);
+        } };
+
+    constexpr unsigned highestID{ std::numeric_limits<unsigned>::max() };
+
+    do
+    {
+        if (reader.acceptKeyword("id"))
+        {
+            if (reader.acceptKeyword("between"))
+            {
+                std::optional<unsigned> lowest{ reader.acceptID() };
+
+                if (!lowest || !reader.acceptKeyword("and"))
+                {
+                    error = "expected id between <id> and <id>";
+                    return std::nullopt;
+                }
+
+                std::optional<unsigned> highest{ reader.acceptID() };
+
+                if (!highest)
+                {
+                    error = "expected id between <id> and <id>";
+                    return std::nullopt;
+                }
+
+                narrow(*lowest, *highest);
+                continue;
+            }
+
+            std::optional<std::string_view> symbol{ reader.acceptSymbol() };
+
+            if (!symbol)
+            {
+                error = "expected a comparison or between after id";
+                return std::nullopt;
+            }
+
+            std::optional<unsigned> id{ reader.acceptID() };
+
+            if (!id)
+            {
+                error = "expected an ID";
+                return std::nullopt;
+            }
+
+            // Comparisons that no ID satisfies leave an empty range.
+            if (*symbol == "=")         { narrow(*id, *id); }
+            else if (*symbol == "!=")   { query.m_excludedIDs.push_back(*id); }
+            else if (*symbol == "<")    { *id == 0 ? narrow(1, 0) : narrow(0, *id - 1); }
+            else if (*symbol == "<=")   { narrow(0, *id); }
+            else if (*symbol == ">")    { *id == highestID ? narrow(1, 0) : narrow(*id + 1, highestID); }
+            else                        { narrow(*id, highestID); }
+        }
+        else if (reader.acceptKeyword("name"))
+        {
+            std::optional<NameTest::Kind> kind;
+
+            if (std::optional<std::string_view> symbol{ reader.acceptSymbol() })
+            {
+                kind = *symbol == "=" ? std::optional{ NameTest::Kind::equals }
+                     : *symbol == "!=" ? std::optional{ NameTest::Kind::notEquals } : std::nullopt;
+            }
+            else if (reader.acceptKeyword("starts"))
+            {
+                kind = reader.acceptKeyword("with") ? std::optional{ NameTest::Kind::startsWith } : std::nullopt;
+            }
+            else if (reader.acceptKeyword("contains"))
+            {
+                kind = NameTest::Kind::contains;
+            }
+
+            if (!kind)
+            {
+                error = "expected = or != or starts with or contains after name";
+                return std::nullopt;
+            }
+
+            std::optional<std::string_view> name{ reader.acceptText() };
+
+            if (!name)
+            {
+                error = "expected a name";
+                return std::nullopt;
+            }
+
+            query.m_nameTests.push_back({ *kind, std::string{ *name } });
+        }
+        else if (reader.acceptKeyword("title"))
+        {
+            std::optional<std::string_view> symbol{ reader.acceptSymbol() };
+
+            if (!symbol || (*symbol != "=" && *symbol != "!="))
+            {
+                error = "expected = or != after title";
+                return std::nullopt;
+            }
+
+            std::optional<std::string_view> title{ reader.acceptText() };
+            std::optional<Role> role{ title ? parseRoleOrTitle(*title) : std::nullopt };
+
+            if (!role)
+            {
+                error = "expected a role";
+                return std::nullopt;
+            }
+
+            std::bitset<roleCount> selected;
+            selected.set(static_cast<std::size_t>(*role));
+
+            query.m_roles &= *symbol == "=" ? selected : ~selected;
+        }
+        else
+        {
+            error = "expected a condition on id or name or title";
+            return std::nullopt;
+        }
+    }
+    while (reader.acceptKeyword("and"));
+
+    if (!reader.atEnd())
+    {
+        error = "expected and between conditions";
+        return std::nullopt;
+    }
+
+    // Exact comparisons are cheapest and most selective, so go first.
+    std::ranges::stable_sort(query.m_nameTests, {}, &NameTest::kind);
+
+    return query;
+}
+
+bool EmployeeQuery::matches(unsigned id, std::string_view name, Role role) const
+{
+    if (id < m_lowestID || id > m_highestID || !allowsRole(role))
+    {
+        return false;
+    }
+
+    if (!m_excludedIDs.empty() && std::ranges::find(m_excludedIDs, id) != m_excludedIDs.end())
+    {
+        return false;
+    }
+
+    for (NameTest const &test : m_nameTests)
+    {
+        bool passed{};
+
+        switch (test.kind)
+        {
+            case NameTest::Kind::equals:
+                passed = name == test.text;
+                break;
+            case NameTest::Kind::notEquals:
+                passed = name != test.text;
+                break;
+            case NameTest::Kind::startsWith:
+                passed = name.starts_with(test.text);
+                break;
+            case NameTest::Kind::contains:
+                passed = name.contains(test.text);
+                break;
+        }
+
+        if (!passed)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::optional<std::string_view> EmployeeQuery::exactName() const
+{
+    if (m_nameTests.empty() || m_nameTests.front().kind != NameTest::Kind::equals)
+    {
+        return std::nullopt;
+    }
+
+    return m_nameTests.front().text;
+}
+
+std::optional<std::string_view> EmployeeQuery::namePrefix() const
+{
+    std::optional<std::string_view> prefix;
+
+    for (NameTest const &test : m_nameTests)
+    {
+        if (test.kind == NameTest::Kind::startsWith && (!prefix || test.text.size() > prefix->size()))
+        {
+            prefix = test.text;
+        }
+    }
+
+    return prefix;
+}
@@ -0,0 +1,87 @@
+//******************************************************************************
+//File Name: employeeQuery.hpp
+//Description: Filter queries over employees, compiled from text.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef EMPLOYEE_QUERY_HPP
+#define EMPLOYEE_QUERY_HPP
+
+#include "roles.hpp"
+
+#include <bitset>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+// Conjunction of conditions on an employee's ID, name and title, e.g.
+//
+//   title = ManagerEmployee and name starts with 'D' and id between 1000 and 5000
+//
+// Each condition is one of
+//
+//   id =|!=|<|<=|>|>= <id>
+//   id between <id> and <id>
+//   name =|!= <text>
+//   name starts with <text>
+//   name contains <text>
+//   title =|!= <role>
+//
+// joined by `and`.  Keywords are not case sensitive.  Text is a single word,
+// or quoted with ' or " when it has spaces, and a role is written as in the
+// database or, quoted, as displayed.
+//
+// Compiling folds every ID condition but `!=` into one range and every title
+// condition into a set of roles, which are all an index needs, and orders
+// the rest from cheapest to dearest, so `matches` is a short pipeline of
+// tests that stops at the first failing.
+class EmployeeQuery
+{
+public:
+    // Compiles `text`, or returns nullopt and sets `error` to the reason.
+    static std::optional<EmployeeQuery> compile(std::string_view text, std::string_view &error);
+
+    bool matches(unsigned id, std::string_view name, Role role) const;
+
+    // Whether the conditions contradict each other, so nothing matches.
+    bool matchesNothing() const { return m_lowestID > m_highestID || m_roles.none(); }
+
+    // Every match has an ID within this inclusive range and one of these roles.
+    unsigned lowestID() const { return m_lowestID; }
+    unsigned highestID() const { return m_highestID; }
+    bool allowsRole(Role role) const { return m_roles.test(static_cast<std::size_t>(role)); }
+
+    // The name every match has, if a condition requires one.
+    std::optional<std::string_view> exactName() const;
+
+    // A prefix every match's name starts with, the longest if several are.
+    std::optional<std::string_view> namePrefix() const;
+
+private:
+    struct NameTest
+    {
+        enum struct Kind : std::uint8_t
+        {
+            equals,         // In order of cost, see `compile`.
+            notEquals,
+            startsWith,
+            contains,
+        };
+
+        Kind kind;
+        std::string text;
+    };
+
+    unsigned m_lowestID{};
+    unsigned m_highestID{ std::numeric_limits<unsigned>::max() };
+    std::bitset<roleCount> m_roles{ std::bitset<roleCount>{}.set() };
+    std::vector<unsigned> m_excludedIDs;
+    std::vector<NameTest> m_nameTests;
+};
+
+#endif
@@ -0,0 +1,195 @@
+//******************************************************************************
+//File Name: employeeStore.cpp
+//Description: Implementation for EmployeeStore object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "employeeStore.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+
+static_assert(maxFieldLength <= StringRef::maxLength, "Every valid field fits a StringRef.");
+
+EmployeeStore EmployeeStore::fromColumns(std::vector<unsigned> ids, std::vector<Role> roles,
+                                         std::vector<StringRef> names, std::vector<StringRef> passwords,
+                                         std::string_view borrowed)
+{
+    EmployeeStore store;
+
+    store.m_removed.assign(ids.size(), false);
+    store.m_positionSlots.resize(ids.size());
+    std::iota(store.m_positionSlots.begin(), store.m_positionSlots.end(), std::uint32_t{});
+    store.m_slotPositions = store.m_positionSlots;
+    store.m_slotGenerations.assign(ids.size(), 0);
+    store.m_ids = std::move(ids);
+    store.m_roles = std::move(roles);
+    store.m_names = std::move(names);
+    store.m_passwords = std::move(passwords);
+    store.m_borrowed = borrowed;
+
+    return store;
+}
+
+std::uint32_t EmployeeStore::append(EmployeeBuilder const &params)
+{
+    m_ids.push_back(params.id);
+    m_roles.push_back(params.role);
+    m_names.push_back(params.borrowFields ? borrow(params.name) : ownName(params.name));
+    m_passwords.push_back(params.borrowFields ? borrow(params.password) : ownPassword(params.password));
+    m_removed.push_back(false);
+    m_positionSlots.push_back(allocateSlot(size() - 1));
+
+    return size() - 1;
+}
+
+void EmployeeStore::append(EmployeeStore &&other)
+{
+    // Owned strings of `other` land after ours, so their offsets shift.
+    std::uint64_t const shift{ m_strings.absorb(std::move(other.m_strings)) };
+
+    auto rebase{ [shift](StringRef ref)
+        {
+            return ref.borrowed() ? ref : StringRef{ ref.offset() + shift, ref.length(), false };
+        } };
+
+    m_ids.insert(m_ids.end(), other.m_ids.begin(), other.m_ids.end());
+    m_roles.insert(m_roles.end(), other.m_roles.begin(), other.m_roles.end());
+    std::ranges::transform(other.m_names, std::back_inserter(m_names), rebase);
+    std::ranges::transform(other.m_passwords, std::back_inserter(m_passwords), rebase);
+    m_removed.insert(m_removed.end(), other.m_removed.begin(), other.m_removed.end());
+    m_removedCount += other.m_removedCount;
+
+    // Handles into `other` are not carried over, each record gets a new slot.
+    for (std::uint32_t position{ size() - other.size() }; position < size(); ++position)
+    {
+        m_positionSlots.push_back(m_removed[position] ? npos : allocateSlot(position));
+    }
+
+    other = EmployeeStore{};
+}
+
+void EmployeeStore::reserve(std::size_t count)
+{
+    m_ids.reserve(count);
+    m_roles.reserve(count);
+    m_names.reserve(count);
+    m_passwords.reserve(count);
+    m_removed.reserve(count);
+    m_positionSlots.reserve(count);
+    m_slotPositions.reserve(count);
+    m_slotGenerations.reserve(count);
+}
+
+void EmployeeStore::erase(std::uint32_t position)
+{
+    if (!m_removed[position])
+    {
+        m_removed[position] = true;
+        ++m_removedCount;
+
+        std::uint32_t slot{ m_positionSlots[position] };
+        m_slotPositions[slot] = npos;
+        ++m_slotGenerations[slot];
+        m_freeSlots.push_back(slot);
+        m_positionSlots[position] = npos;
+    }
+}
+
+void EmployeeStore::compact()
+{
+    std::uint32_t kept{};
+
+    for (std::uint32_t position{}; position < size(); ++position)
+    {
+        if (m_removed[position])
+        {
+            continue;
+        }
+
+        m_ids[kept] = m_ids[position];
+        m_roles[kept] = m_roles[position];
+        m_names[kept] = m_names[position];
+        m_passwords[kept] = m_passwords[position];
+        m_positionSlots[kept] = m_positionSlots[position];
+        m_slotPositions[m_positionSlots[kept]] = kept;
+        ++kept;
+    }
+
+    // Capacity is kept for the records that replace those removed.
+    m_ids.resize(kept);
+    m_roles.resize(kept);
+    m_names.resize(kept);
+    m_passwords.resize(kept);
+    m_positionSlots.resize(kept);
+    m_removed.assign(kept, false);
+    m_removedCount = 0;
+}
+
+std::uint32_t EmployeeStore::allocateSlot(std::uint32_t position)
+{
+    if (m_freeSlots.empty())
+    {
+        m_slotPositions.push_back(position);
+        m_slotGenerations.push_back(0);
+        return static_cast<std::uint32_t>(m_slotPositions.size() - 1);
+    }
+
+    std::uint32_t slot{ m_freeSlots.back() };
+    m_freeSlots.pop_back();
+    m_slotPositions[slot] = position;
+
+    return slot;
+}
+
+StringRef EmployeeStore::ownName(std::string_view name)
+{
+    return { m_strings.intern(name), name.size(), false };
+}
+
+StringRef EmployeeStore::ownPassword(std::string_view password)
+{
+    // Passwords are rarely shared, so interning them would only cost memory.
+    return { m_strings.store(password), password.size(), false };
+}
+
+EmployeeStore EmployeeStore::share() const
+{
+    EmployeeStore shared;
+
+    shared.m_ids = m_ids;
+    shared.m_roles = m_roles;
+    shared.m_names = m_names;
+    shared.m_passwords = m_passwords;
+    shared.m_removed = m_removed;
+    shared.m_removedCount = m_removedCount;
+    shared.m_slotPositions = m_slotPositions;
+    shared.m_slotGenerations = m_slotGenerations;
+    shared.m_positionSlots = m_positionSlots;
+    shared.m_freeSlots = m_freeSlots;
+    shared.m_borrowed = m_borrowed;
+    shared.m_strings = m_strings.share();
+
+    return shared;
+}
+
+std::size_t EmployeeStore::memoryUsage() const
+{
+    return m_ids.capacity() * sizeof(unsigned)
+         + m_roles.capacity() * sizeof(Role)
+         + m_names.capacity() * sizeof(StringRef)
+         + m_passwords.capacity() * sizeof(StringRef)
+         + m_removed.capacity() / 8
+         + (m_slotPositions.capacity() + m_slotGenerations.capacity() + m_positionSlots.capacity()
+            + m_freeSlots.capacity()) * sizeof(std::uint32_t)
+         + m_strings.bytesReserved();
+}
+
+StringRef EmployeeStore::borrow(std::string_view text) const
+{
+    return { static_cast<std::uint64_t>(text.data() - m_borrowed.data()), text.size(), true };
+}
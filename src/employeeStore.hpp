@@ -0,0 +1,212 @@
+//******************************************************************************
+//File Name: employeeStore.hpp
+//Description: Contiguous, column oriented storage for employee records.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef EMPLOYEE_STORE_HPP
+#define EMPLOYEE_STORE_HPP
+
+#include "roles.hpp"
+#include "stringArena.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+
+// Builder object that makes record construction easier.  When `borrowFields`
+// is set, name and password must view the store's borrowed buffer (e.g. a
+// memory mapped database) and are referenced there instead of being copied.
+struct EmployeeBuilder
+{
+    unsigned id;
+    std::string_view name;
+    std::string_view password;
+    Role role;
+    bool borrowFields{ false };
+};
+
+// Longest name or password a record may hold.
+inline constexpr std::size_t maxFieldLength{ 1024 };
+
+// Whether `text` may be stored as a name or password.  Longer text is
+// rejected where it is entered rather than cut short, so a stored password
+// always matches the one typed, and so are the commas and line breaks that
+// separate the fields and records of the CSV database, so it is saved as
+// exactly one field.
+constexpr bool isValidField(std::string_view text)
+{
+    return text.size() <= maxFieldLength && text.find_first_of(",\r\n") == std::string_view::npos;
+}
+
+// Stable reference to a record.  It survives every modification of the
+// record, compaction of its store and copies of the store, but no longer
+// resolves once the record is removed, even after its slot is reused.
+struct EmployeeHandle
+{
+    std::uint32_t slot;
+    std::uint32_t generation;
+
+    bool operator==(EmployeeHandle const &) const = default;
+};
+
+// Location of a string in one of the store's buffers, packed into 64 bits: a
+// 40 bit offset, a 23 bit length and a flag selecting the borrowed buffer.
+class StringRef
+{
+public:
+    static constexpr std::size_t maxLength{ (std::size_t{ 1 } << 23) - 1 };
+
+    StringRef() = default;
+
+    StringRef(std::uint64_t offset, std::size_t length, bool borrowed)
+    : m_bits{ offset | (std::uint64_t{ length } << offsetBits) | (std::uint64_t{ borrowed } << 63) }
+    {}
+
+    std::uint64_t offset() const { return m_bits & ((std::uint64_t{ 1 } << offsetBits) - 1); }
+    std::size_t length() const { return (m_bits >> offsetBits) & maxLength; }
+    bool borrowed() const { return (m_bits >> 63) != 0; }
+
+private:
+    static constexpr unsigned offsetBits{ 40 };
+
+    std::uint64_t m_bits{};
+};
+
+// Stores every employee field in its own contiguous column, indexed by record
+// position.  Names and passwords are StringRefs into either a borrowed buffer,
+// which is never copied, or a string arena owned by the store in which names
+// are interned.  Removed records are marked rather than erased, so positions
+// are stable until the store is compacted.
+//
+// Records are also reachable through a generational slot table, whose
+// handles stay valid across compaction.  A removed record's slot is reused
+// with its generation advanced, so stale handles are detected in O(1).
+class EmployeeStore
+{
+public:
+    // Returned by `positionOf` for handles that no longer resolve.
+    static constexpr std::uint32_t npos{ std::numeric_limits<std::uint32_t>::max() };
+
+    // Builds a store directly from complete columns, all of whose strings are
+    // borrowed from `borrowed`, which must outlive the store.
+    static EmployeeStore fromColumns(std::vector<unsigned> ids, std::vector<Role> roles,
+                                     std::vector<StringRef> names, std::vector<StringRef> passwords,
+                                     std::string_view borrowed);
+
+    // Sets the buffer that borrowed fields view, which must outlive the store.
+    void borrowFrom(std::string_view buffer) { m_borrowed = buffer; }
+
+    // Adds a record, returning its position.  Its name and password must
+    // satisfy isValidField.
+    std::uint32_t append(EmployeeBuilder const &params);
+
+    // Moves every record of `other`, which must borrow from the same buffer,
+    // onto the end of this store.
+    void append(EmployeeStore &&other);
+
+    void reserve(std::size_t count);
+
+    // Marks the record at `position` as removed and releases its slot.
+    void erase(std::uint32_t position);
+
+    bool isLive(std::uint32_t position) const { return !m_removed[position]; }
+
+    // Handle of the live record at `position`.
+    EmployeeHandle handle(std::uint32_t position) const
+    {
+        std::uint32_t slot{ m_positionSlots[position] };
+        return { slot, m_slotGenerations[slot] };
+    }
+
+    // Position of the record `handle` refers to, or npos once it is removed.
+    std::uint32_t positionOf(EmployeeHandle handle) const
+    {
+        if (handle.slot >= m_slotPositions.size() || m_slotGenerations[handle.slot] != handle.generation)
+        {
+            return npos;
+        }
+
+        return m_slotPositions[handle.slot];
+    }
+
+    // Column accessors.
+    unsigned id(std::uint32_t position) const { return m_ids[position]; }
+    Role role(std::uint32_t position) const { return m_roles[position]; }
+    std::string_view name(std::uint32_t position) const { return resolve(m_names[position]); }
+    std::string_view password(std::uint32_t position) const { return resolve(m_passwords[position]); }
+
+    // Column mutators.  Strings, which must satisfy isValidField, are copied
+    // into the owned buffer; views previously returned by `name` or
+    // `password` may be invalidated.
+    void setID(std::uint32_t position, unsigned id) { m_ids[position] = id; }
+    void setRole(std::uint32_t position, Role role) { m_roles[position] = role; }
+    void setName(std::uint32_t position, std::string_view name) { m_names[position] = ownName(name); }
+    void setPassword(std::uint32_t position, std::string_view password) { m_passwords[position] = ownPassword(password); }
+
+    // Number of positions, including removed records.
+    std::uint32_t size() const { return static_cast<std::uint32_t>(m_ids.size()); }
+
+    // Number of records that have not been removed.
+    std::size_t liveCount() const { return m_ids.size() - m_removedCount; }
+
+    // Whether removed records take up enough of the columns to be worth
+    // compacting, i.e. most of them.
+    bool isSparse() const { return m_removedCount >= minimumCompaction && m_removedCount > liveCount(); }
+
+    // Drops removed records, moving the rest down in order.  Positions change
+    // but handles do not.  Costs O(size), which `isSparse` amortises over the
+    // removals that made it worthwhile.
+    void compact();
+
+    // Point in time copy, which may be read on another thread while this store
+    // continues to change.  Columns are copied, but strings are shared with
+    // this store, which only ever appends them.
+    EmployeeStore share() const;
+
+    // Bytes allocated by the store, excluding any borrowed buffer.
+    std::size_t memoryUsage() const;
+
+private:
+    std::string_view resolve(StringRef ref) const
+    {
+        if (ref.borrowed())
+        {
+            return m_borrowed.substr(ref.offset(), ref.length());
+        }
+
+        return m_strings.view(ref.offset(), ref.length());
+    }
+
+    // Fewest removed records worth compacting away.
+    static constexpr std::size_t minimumCompaction{ 1024 };
+
+    std::uint32_t allocateSlot(std::uint32_t position);
+
+    StringRef ownName(std::string_view name);
+    StringRef ownPassword(std::string_view password);
+    StringRef borrow(std::string_view text) const;
+
+    std::vector<unsigned> m_ids;
+    std::vector<Role> m_roles;
+    std::vector<StringRef> m_names;
+    std::vector<StringRef> m_passwords;
+    std::vector<bool> m_removed;
+    std::size_t m_removedCount{};
+
+    // Slot table: the position and generation of each slot, the slot of each
+    // position and the slots free for reuse.
+    std::vector<std::uint32_t> m_slotPositions;
+    std::vector<std::uint32_t> m_slotGenerations;
+    std::vector<std::uint32_t> m_positionSlots;
+    std::vector<std::uint32_t> m_freeSlots;
+
+    std::string_view m_borrowed;
+    StringArena m_strings;
+};
+
+#endif
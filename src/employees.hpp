@@ -1,6 +1,6 @@
 //******************************************************************************
 //File Name: employees.hpp
-//Description: Employee base class for CS112: Assignment 1.
+//Description: Employee record handle for CS112: Assignment 1.
 //Author: Austin Bachurski
 //Created: January 20, 2026
 //******************************************************************************
@@ -8,168 +8,104 @@
 #ifndef EMPLOYEE_BASE_HPP
 #define EMPLOYEE_BASE_HPP
 
+#include "console.hpp"
+#include "employeeStore.hpp"
+#include "roles.hpp"
+
+#include <cstdint>
 #include <format>
 #include <print>
 #include <string>
 #include <string_view>
 
 
-// Employee base class.
+// Thin handle to one record of an EmployeeStore.  The role is read from the
+// record's tag and looked up in the role registry, so no per-record object or
+// virtual call is involved.
 class Employee
 {
 public:
-    // Destructor must be declared as virtual when using virtual functions.
-    virtual ~Employee() = default;
-
-    // Builder object that makes Employee object construction easier.
-    struct EmployeeBuilder
-    {
-        unsigned id;
-        std::string_view name;
-        std::string_view password;
-    };
+    Employee(EmployeeStore const &store, std::uint32_t position)
+    : m_store{ &store }
+    , m_position{ position }
+    {}
 
     // Getters for various fields.
-    unsigned getID() const { return m_id; }
-    std::string_view getName() const { return m_name; } 
-    std::string_view getPassword() const { return m_password; } 
+    unsigned getID() const { return m_store->id(m_position); }
+    std::string_view getName() const { return m_store->name(m_position); }
+    std::string_view getPassword() const { return m_store->password(m_position); }
+    Role getRole() const { return m_store->role(m_position); }
 
-    // Password comparison.
-    bool isCorrectPassword(std::string_view password) const { return password == m_password; }
-
-    // Setters for various fields.
-    void setID(unsigned id) { m_id = id; }
-    void setName(std::string_view name) { m_name = name; }
-    void setPassword(std::string_view password) { m_password = password; }
-
-    // Virtual function that displays the available menu options for a given employee type.
-    virtual void displayMenu() const = 0;
-
-    // Virtual function that returns the title of a given employee type as a 
-    // string_view.  Used for printing an Employee object.
-    virtual std::string_view getTitle() const = 0;
-
-    // Virtual functions to enable functionality based on a given employee type.
-    virtual bool canViewEmployees() const = 0;
-    virtual bool canSearchEmployees() const = 0;
-    virtual bool canModifyEmployee() const = 0;
-    virtual bool canAddEmployee() const = 0;
-    virtual bool canRemoveEmployee() const = 0;
-
-protected:
-    // Hide base class constructor.
-    Employee(EmployeeBuilder const &params)
-    : m_id{ params.id }
-    , m_name{ params.name }
-    , m_password{ params.password }
-    {}
-
-private:
-    // Private id, name, and password fields.
-    unsigned m_id{};
-    std::string m_name;
-    std::string m_password;
-};
+    // Stable handle to the record, see EmployeeHandle.
+    EmployeeHandle handle() const { return m_store->handle(m_position); }
 
-// General Employee derived class.
-class GeneralEmployee : public Employee
-{
-public:
-    GeneralEmployee(EmployeeBuilder const &params)
-    : Employee(params)
-    {}
+    // Password comparison.
+    bool isCorrectPassword(std::string_view password) const { return password == getPassword(); }
 
-    void displayMenu() const override
+    // Displays the available menu options for the employee's role.
+    void displayMenu() const
     {
-        std::println(
-            "Logged in as General Employee: {}\n"
-            "Please make a selection:\n"
-            "0. Exit\n"
-            "1. View employee file.\n",
-            getName()
-        );
+        consolePrintln("Logged in as {}: {}\nPlease make a selection:\n{}", getTitle(), getName(), roleMenu(getRole()));
     }
 
-    std::string_view getTitle() const override  { return "General Employee"; }
-    bool canViewEmployees()     const override  { return false; }
-    bool canSearchEmployees()   const override  { return false; }
-    bool canModifyEmployee()    const override  { return false; }
-    bool canAddEmployee()       const override  { return false; }
-    bool canRemoveEmployee()    const override  { return false; }
-};
+    // Returns the title of the employee's role as a string_view.  Used for
+    // printing an Employee object.
+    std::string_view getTitle() const { return roleInfo(getRole()).title; }
 
-// Human Resources Employee derived class.
-class HumanResourcesEmployee : public Employee
-{
-public:
-    HumanResourcesEmployee(EmployeeBuilder const &params)
-    : Employee(params)
-    {}
-
-    void displayMenu() const override
-    {
-        std::println(
-            "Logged in as Human Resources Employee: {}\n"
-            "Please make a selection:\n"
-            "0. Exit\n"
-            "1. View employees.\n"
-            "2. Search for an employee.\n"
-            "3. Modify an employee.\n"
-            "4. Add an employee.\n"
-            "5. Remove an employee.\n",
-            getName()
-        );
-    }
+    // Functions to enable functionality based on the employee's role, each a
+    // single bit test against the role registry.
+    bool canViewEmployees()     const { return hasCapability(getRole(), Capability::viewEmployees); }
+    bool canSearchEmployees()   const { return hasCapability(getRole(), Capability::searchEmployees); }
+    bool canModifyEmployee()    const { return hasCapability(getRole(), Capability::modifyEmployee); }
+    bool canAddEmployee()       const { return hasCapability(getRole(), Capability::addEmployee); }
+    bool canRemoveEmployee()    const { return hasCapability(getRole(), Capability::removeEmployee); }
+    bool canBrowseEmployees()   const { return hasCapability(getRole(), Capability::browseEmployees); }
+    bool canViewReports()       const { return hasCapability(getRole(), Capability::viewReports); }
 
-    std::string_view getTitle() const override  { return "Human Resources Employee"; }
-    bool canViewEmployees()     const override  { return true; }
-    bool canSearchEmployees()   const override  { return true; }
-    bool canModifyEmployee()    const override  { return true; }
-    bool canAddEmployee()       const override  { return true; }
-    bool canRemoveEmployee()    const override  { return true; }
+private:
+    EmployeeStore const *m_store;
+    std::uint32_t m_position;
 };
 
-// Manager Employee derived class.
-class ManagerEmployee : public Employee
+// Employee whose fields are owned rather than viewed in a store, as kept by
+// BoundedEmployeeDatabase.  It offers the getters sessions use on Employee,
+// so either can be displayed and checked alike.
+struct EmployeeRecord
 {
-public:
-    ManagerEmployee(EmployeeBuilder const &params)
-    : Employee(params)
-    {}
+    unsigned id;
+    std::string name;
+    std::string password;
+    Role role;
+
+    unsigned getID() const { return id; }
+    std::string_view getName() const { return name; }
+    std::string_view getPassword() const { return password; }
+    Role getRole() const { return role; }
+    std::string_view getTitle() const { return roleInfo(role).title; }
 
-    void displayMenu() const override
+    bool isCorrectPassword(std::string_view candidate) const { return candidate == password; }
+
+    void displayMenu() const
     {
-        std::println(
-            "Logged in as Manager Employee: {}\n"
-            "Please make a selection:\n"
-            "0. Exit\n"
-            "1. View employees.\n"
-            "2. Search for an employee.\n",
-            getName()
-        );
+        consolePrintln("Logged in as {}: {}\nPlease make a selection:\n{}", getTitle(), name, roleMenu(role));
     }
 
-    std::string_view getTitle() const override  { return "Manager Employee"; }
-    bool canViewEmployees()     const override  { return true; }
-    bool canSearchEmployees()   const override  { return true; }
-    bool canModifyEmployee()    const override  { return false; }
-    bool canAddEmployee()       const override  { return false; }
-    bool canRemoveEmployee()    const override  { return false; }
+    bool canViewEmployees() const { return hasCapability(role, Capability::viewEmployees); }
 };
 
 // The std::formatter object is required by the std::print and std::println functions of the 
 // C++ Standard Template Library.  It defines how the object will be printed.
-// In this case, it is the Employee object.  The title for the derived classes
-// is retrieved by a virtual function call.
-template<>
-struct std::formatter<Employee>
+// In this case, it is the Employee object, or an EmployeeRecord, printed the
+// same way.  The title is derived from the record's role tag.
+template<typename Record>
+struct EmployeeFormatter
 {
     constexpr auto parse(std::format_parse_context &context)
     {
         return context.begin();
     }
     
-    auto format(Employee const &employee, std::format_context &context) const
+    auto format(Record const &employee, std::format_context &context) const
     {
         return std::format_to(context.out(),
                               "Employee ID: {}\n"
@@ -182,5 +118,10 @@ struct std::formatter<Employee>
     }
 };
 
-#endif
+template<>
+struct std::formatter<Employee> : EmployeeFormatter<Employee> {};
 
+template<>
+struct std::formatter<EmployeeRecord> : EmployeeFormatter<EmployeeRecord> {};
+
+#endif
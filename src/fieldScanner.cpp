@@ -0,0 +1,166 @@
+//******************************************************************************
+//File Name: fieldScanner.cpp
+//Description: Implementation for vectorized CSV delimiter scanning.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "fieldScanner.hpp"
+
+#include <bit>
+#include <charconv>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+using ScanFunction = std::uint64_t (*)(char const *);
+
+std::uint64_t scanScalar(char const *block)
+{
+    std::uint64_t mask{};
+
+    for (std::size_t i{}; i < scanBlockSize; ++i)
+    {
+        if (block[i] == ',' || block[i] == '\n')
+        {
+            mask |= std::uint64_t{ 1 } << i;
+        }
+    }
+
+    return mask;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+__attribute__((target("sse2")))
+std::uint64_t scanSSE2(char const *block)
+{
+    __m128i const commas{ _mm_set1_epi8(',') };
+    __m128i const newlines{ _mm_set1_epi8('\n') };
+    std::uint64_t mask{};
+
+    for (std::size_t i{}; i < scanBlockSize; i += 16)
+    {
+        __m128i bytes{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(block + i)) };
+        __m128i matches{ _mm_or_si128(_mm_cmpeq_epi8(bytes, commas), _mm_cmpeq_epi8(bytes, newlines)) };
+        mask |= std::uint64_t{ static_cast<std::uint16_t>(_mm_movemask_epi8(matches)) } << i;
+    }
+
+    return mask;
+}
+
+__attribute__((target("avx2")))
+std::uint64_t scanAVX2(char const *block)
+{
+    __m256i const commas{ _mm256_set1_epi8(',') };
+    __m256i const newlines{ _mm256_set1_epi8('\n') };
+    std::uint64_t mask{};
+
+    for (std::size_t i{}; i < scanBlockSize; i += 32)
+    {
+        __m256i bytes{ _mm256_loadu_si256(reinterpret_cast<__m256i const *>(block + i)) };
+        __m256i matches{ _mm256_or_si256(_mm256_cmpeq_epi8(bytes, commas), _mm256_cmpeq_epi8(bytes, newlines)) };
+        mask |= std::uint64_t{ static_cast<std::uint32_t>(_mm256_movemask_epi8(matches)) } << i;
+    }
+
+    return mask;
+}
+
+#endif
+
+struct Scanner
+{
+    ScanFunction scan;
+    std::string_view name;
+};
+
+Scanner selectScanner()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return { scanAVX2, "AVX2" };
+    }
+
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return { scanSSE2, "SSE2" };
+    }
+#endif
+
+    return { scanScalar, "scalar" };
+}
+
+Scanner const &scanner()
+{
+    static Scanner const selected{ selectScanner() };
+    return selected;
+}
+
+// True when all eight bytes of `chunk` are ASCII digits.
+bool isEightDigits(std::uint64_t chunk)
+{
+    return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4))
+        == 0x3333333333333333;
+}
+
+// Converts eight ASCII digits, most significant in the lowest byte, to binary.
+std::uint32_t parseEightDigits(std::uint64_t chunk)
+{
+    chunk = ((chunk & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+    chunk = ((chunk & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+    return static_cast<std::uint32_t>(((chunk & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+}
+
+} // anonymous namespace
+
+std::uint64_t scanDelimiters(char const *block, std::size_t length)
+{
+    if (length == scanBlockSize)
+    {
+        return scanner().scan(block);
+    }
+
+    // Partial blocks are padded so the vector loads never read past the end.
+    char padded[scanBlockSize]{};
+    std::memcpy(padded, block, length);
+
+    return scanner().scan(padded) & ((std::uint64_t{ 1 } << length) - 1);
+}
+
+std::string_view delimiterScannerName()
+{
+    return scanner().name;
+}
+
+bool parseEmployeeID(std::string_view field, unsigned &id)
+{
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        if (!field.empty() && field.size() <= sizeof(std::uint64_t))
+        {
+            // Right align the digits behind leading zeros.
+            char digits[sizeof(std::uint64_t)];
+            std::memset(digits, '0', sizeof(digits));
+            std::memcpy(digits + sizeof(digits) - field.size(), field.data(), field.size());
+
+            std::uint64_t chunk;
+            std::memcpy(&chunk, digits, sizeof(chunk));
+
+            if (isEightDigits(chunk))
+            {
+                id = parseEightDigits(chunk);
+                return true;
+            }
+        }
+    }
+
+    return std::from_chars(field.data(), field.data() + field.size(), id).ec == std::errc{};
+}
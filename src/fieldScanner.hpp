@@ -0,0 +1,99 @@
+//******************************************************************************
+//File Name: fieldScanner.hpp
+//Description: Vectorized CSV delimiter scanning and ID parsing.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef FIELD_SCANNER_HPP
+#define FIELD_SCANNER_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+
+// Number of bytes examined by each call to `scanDelimiters`.
+inline constexpr std::size_t scanBlockSize{ 64 };
+
+// Number of fields in an employee record.
+inline constexpr std::size_t recordFieldCount{ 4 };
+
+// Returns a mask with bit `i` set when `block[i]` is a comma or newline.  Only
+// the first `length` bytes (at most `scanBlockSize`) are examined.  The
+// implementation (AVX2, SSE2 or scalar) is chosen once at runtime.
+std::uint64_t scanDelimiters(char const *block, std::size_t length);
+
+// Name of the scanner implementation selected for this processor.
+std::string_view delimiterScannerName();
+
+// Parses the leading digits of an ID field.  Fields of up to eight digits are
+// converted without a loop, anything else falls back to std::from_chars.
+bool parseEmployeeID(std::string_view field, unsigned &id);
+
+// Calls `onRecord(line, fields)` for every line in `text`, where `fields` holds
+// up to the first `maxFields` comma separated fields of the line.  A trailing
+// line without a newline is included, an empty trailing line is not.
+// Scanning stops early when `onRecord` returns false.
+template<std::size_t maxFields = recordFieldCount, typename OnRecord>
+void forEachRecord(std::string_view text, OnRecord &&onRecord)
+{
+    std::array<std::string_view, maxFields> fields;
+    std::size_t fieldCount{};
+    std::size_t fieldStart{};
+    std::size_t lineStart{};
+
+    auto finishLine{ [&](std::size_t end)
+        {
+            if (fieldCount < maxFields)
+            {
+                fields[fieldCount++] = text.substr(fieldStart, end - fieldStart);
+            }
+
+            return onRecord(text.substr(lineStart, end - lineStart),
+                            std::span<std::string_view const>{ fields.data(), fieldCount });
+        } };
+
+    for (std::size_t block{}; block < text.size(); block += scanBlockSize)
+    {
+        std::uint64_t mask{ scanDelimiters(text.data() + block,
+                                           std::min(scanBlockSize, text.size() - block)) };
+
+        while (mask)
+        {
+            std::size_t position{ block + static_cast<std::size_t>(std::countr_zero(mask)) };
+            mask &= mask - 1;
+
+            if (text[position] == ',')
+            {
+                if (fieldCount < maxFields)
+                {
+                    fields[fieldCount++] = text.substr(fieldStart, position - fieldStart);
+                }
+            }
+            else
+            {
+                if (!finishLine(position))
+                {
+                    return;
+                }
+
+                fieldCount = 0;
+                lineStart = position + 1;
+            }
+
+            fieldStart = position + 1;
+        }
+    }
+
+    if (lineStart < text.size())
+    {
+        finishLine(text.size());
+    }
+}
+
+#endif
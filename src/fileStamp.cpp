@@ -0,0 +1,36 @@
+//******************************************************************************
+//File Name: fileStamp.cpp
+//Description: Implementation for FileStamp.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "fileStamp.hpp"
+
+#include <system_error>
+
+
+FileStamp stampOf(std::filesystem::path const &path)
+{
+    std::error_code error;
+    FileStamp stamp;
+
+    auto size{ std::filesystem::file_size(path, error) };
+
+    if (error)
+    {
+        return {};
+    }
+
+    auto modified{ std::filesystem::last_write_time(path, error) };
+
+    if (error)
+    {
+        return {};
+    }
+
+    stamp.size = size;
+    stamp.modified = modified.time_since_epoch().count();
+
+    return stamp;
+}
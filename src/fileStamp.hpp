@@ -0,0 +1,28 @@
+//******************************************************************************
+//File Name: fileStamp.hpp
+//Description: Identifies a version of a file by its size and modification time.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef FILE_STAMP_HPP
+#define FILE_STAMP_HPP
+
+#include <cstdint>
+#include <filesystem>
+
+
+// Size and modification time of a file, used to tell whether data derived
+// from it (a snapshot or operation log) still matches it.  A missing file has
+// a zero stamp.
+struct FileStamp
+{
+    std::uint64_t size{};
+    std::int64_t modified{};
+
+    bool operator==(FileStamp const &) const = default;
+};
+
+FileStamp stampOf(std::filesystem::path const &path);
+
+#endif
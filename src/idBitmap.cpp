@@ -0,0 +1,279 @@
+//******************************************************************************
+//File Name: idBitmap.cpp
+//Description: Implementation for IdBitmap object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "idBitmap.hpp"
+
+#include <algorithm>
+#include <climits>
+
+
+static_assert(sizeof(unsigned) * CHAR_BIT == 32, "IDs are split into two 16 bit halves.");
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+std::uint16_t highOf(unsigned id) { return static_cast<std::uint16_t>(id >> 16); }
+std::uint16_t lowOf(unsigned id) { return static_cast<std::uint16_t>(id); }
+
+std::uint64_t maskOf(std::uint16_t low) { return std::uint64_t{ 1 } << (low % 64); }
+
+} // anonymous namespace
+
+void IdBitmap::assign(std::span<unsigned const> ids)
+{
+    clear();
+
+    for (std::size_t first{}; first < ids.size();)
+    {
+        std::uint16_t high{ highOf(ids[first]) };
+        std::size_t last{ first + 1 };
+
+        while (last < ids.size() && highOf(ids[last]) == high)
+        {
+            ++last;
+        }
+
+        Group &group{ m_groups.emplace_back(Group{ .high = high, .count = last - first }) };
+
+        if (group.count > arrayLimit)
+        {
+            group.bits.resize(bitmapWords);
+
+            for (unsigned id : ids.subspan(first, group.count))
+            {
+                group.bits[lowOf(id) / 64] |= maskOf(lowOf(id));
+            }
+        }
+        else
+        {
+            group.values.reserve(group.count);
+
+            for (unsigned id : ids.subspan(first, group.count))
+            {
+                group.values.push_back(lowOf(id));
+            }
+        }
+
+        first = last;
+    }
+
+    m_size = ids.size();
+}
+
+void IdBitmap::insert(unsigned id)
+{
+    std::uint16_t high{ highOf(id) };
+    std::uint16_t low{ lowOf(id) };
+    std::size_t position{ groupOf(high) };
+
+    if (position == m_groups.size() || m_groups[position].high != high)
+    {
+        m_groups.insert(m_groups.begin() + static_cast<std::ptrdiff_t>(position), Group{ .high = high });
+    }
+
+    Group &group{ m_groups[position] };
+
+    if (group.isBitmap())
+    {
+        std::uint64_t &word{ group.bits[low / 64] };
+
+        if ((word & maskOf(low)) != 0)
+        {
+            return;
+        }
+
+        word |= maskOf(low);
+    }
+    else
+    {
+        auto found{ std::ranges::lower_bound(group.values, low) };
+
+        if (found != group.values.end() && *found == low)
+        {
+            return;
+        }
+
+        group.values.insert(found, low);
+    }
+
+    ++group.count;
+    ++m_size;
+
+    if (!group.isBitmap() && group.count > arrayLimit)
+    {
+        toBitmap(group);
+    }
+}
+
+void IdBitmap::erase(unsigned id)
+{
+    std::uint16_t high{ highOf(id) };
+    std::uint16_t low{ lowOf(id) };
+    std::size_t position{ groupOf(high) };
+
+    if (position == m_groups.size() || m_groups[position].high != high)
+    {
+        return;
+    }
+
+    Group &group{ m_groups[position] };
+
+    if (group.isBitmap())
+    {
+        std::uint64_t &word{ group.bits[low / 64] };
+
+        if ((word & maskOf(low)) == 0)
+        {
+            return;
+        }
+
+        word &= ~maskOf(low);
+    }
+    else
+    {
+        auto found{ std::ranges::lower_bound(group.values, low) };
+
+        if (found == group.values.end() || *found != low)
+        {
+            return;
+        }
+
+        group.values.erase(found);
+    }
+
+    --group.count;
+    --m_size;
+
+    // Bitmaps only shrink back to arrays well below the limit, so members
+    // added and removed around it do not convert the group every time.
+    if (group.count == 0)
+    {
+        m_groups.erase(m_groups.begin() + static_cast<std::ptrdiff_t>(position));
+    }
+    else if (group.isBitmap() && group.count <= arrayLimit / 2)
+    {
+        toArray(group);
+    }
+}
+
+bool IdBitmap::contains(unsigned id) const
+{
+    std::uint16_t high{ highOf(id) };
+    std::uint16_t low{ lowOf(id) };
+    std::size_t position{ groupOf(high) };
+
+    if (position == m_groups.size() || m_groups[position].high != high)
+    {
+        return false;
+    }
+
+    Group const &group{ m_groups[position] };
+
+    if (group.isBitmap())
+    {
+        return (group.bits[low / 64] & maskOf(low)) != 0;
+    }
+
+    return std::ranges::binary_search(group.values, low);
+}
+
+std::size_t IdBitmap::rank(unsigned id) const
+{
+    std::uint16_t high{ highOf(id) };
+    std::uint16_t low{ lowOf(id) };
+    std::size_t position{ groupOf(high) };
+    std::size_t count{};
+
+    for (std::size_t group{}; group < position; ++group)
+    {
+        count += m_groups[group].count;
+    }
+
+    if (position == m_groups.size() || m_groups[position].high != high)
+    {
+        return count;
+    }
+
+    Group const &group{ m_groups[position] };
+
+    if (!group.isBitmap())
+    {
+        return count + static_cast<std::size_t>(std::ranges::lower_bound(group.values, low) - group.values.begin());
+    }
+
+    for (std::size_t word{}; word < low / 64u; ++word)
+    {
+        count += static_cast<std::size_t>(std::popcount(group.bits[word]));
+    }
+
+    return count + static_cast<std::size_t>(std::popcount(group.bits[low / 64] & (maskOf(low) - 1)));
+}
+
+std::size_t IdBitmap::countInRange(unsigned low, unsigned high) const
+{
+    if (low > high)
+    {
+        return 0;
+    }
+
+    return rank(high) + (contains(high) ? 1 : 0) - rank(low);
+}
+
+std::size_t IdBitmap::memoryUsage() const
+{
+    std::size_t bytes{ m_groups.capacity() * sizeof(Group) };
+
+    for (Group const &group : m_groups)
+    {
+        bytes += group.values.capacity() * sizeof(std::uint16_t) + group.bits.capacity() * sizeof(std::uint64_t);
+    }
+
+    return bytes;
+}
+
+void IdBitmap::clear()
+{
+    m_groups.clear();
+    m_size = 0;
+}
+
+std::size_t IdBitmap::groupOf(std::uint16_t high) const
+{
+    auto found{ std::ranges::lower_bound(m_groups, high, {}, &Group::high) };
+    return static_cast<std::size_t>(found - m_groups.begin());
+}
+
+void IdBitmap::toBitmap(Group &group)
+{
+    group.bits.assign(bitmapWords, 0);
+
+    for (std::uint16_t low : group.values)
+    {
+        group.bits[low / 64] |= maskOf(low);
+    }
+
+    group.values.clear();
+    group.values.shrink_to_fit();
+}
+
+void IdBitmap::toArray(Group &group)
+{
+    group.values.reserve(group.count);
+
+    for (std::size_t word{}; word < bitmapWords; ++word)
+    {
+        for (std::uint64_t bits{ group.bits[word] }; bits != 0; bits &= bits - 1)
+        {
+            std::size_t low{ word * 64 + static_cast<std::size_t>(std::countr_zero(bits)) };
+            group.values.push_back(static_cast<std::uint16_t>(low));
+        }
+    }
+
+    group.bits.clear();
+    group.bits.shrink_to_fit();
+}
@@ -0,0 +1,134 @@
+//******************************************************************************
+//File Name: idBitmap.hpp
+//Description: Compressed bitmap of employee IDs.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef ID_BITMAP_HPP
+#define ID_BITMAP_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+// Set of employee IDs in the manner of a Roaring bitmap.  IDs are grouped by
+// their upper 16 bits, and each group keeps its lower 16 bits in a sorted
+// array while it has at most arrayLimit members, two bytes each, or in a
+// 65536 bit bitmap once it has more, so no group takes more than 8 KiB.
+// The number of members is kept, so `size` is O(1), and listing only visits
+// members, in ascending order.
+class IdBitmap
+{
+public:
+    // Replaces the contents with `ids`, which must be sorted and distinct.
+    void assign(std::span<unsigned const> ids);
+
+    // Adds `id` if not present.
+    void insert(unsigned id);
+
+    // Removes `id` if present.
+    void erase(unsigned id);
+
+    bool contains(unsigned id) const;
+
+    std::size_t size() const { return m_size; }
+
+    // Number of members below `id`, in O(groups) with at most one group's
+    // words counted.
+    std::size_t rank(unsigned id) const;
+
+    // Number of members from `low` to `high` inclusive, as `rank`.
+    std::size_t countInRange(unsigned low, unsigned high) const;
+
+    // Calls `visit(id)` for at most `limit` members in ascending order, after
+    // skipping the first `offset`.  Skipping passes over whole groups, and
+    // over a bitmap group's words with a population count each.
+    template<typename Visit>
+    void forEach(std::size_t offset, std::size_t limit, Visit &&visit) const
+    {
+        for (std::size_t group{}; group < m_groups.size() && limit > 0; ++group)
+        {
+            Group const &members{ m_groups[group] };
+
+            if (offset >= members.count)
+            {
+                offset -= members.count;
+                continue;
+            }
+
+            unsigned const base{ unsigned{ members.high } << 16 };
+
+            if (!members.isBitmap())
+            {
+                for (std::size_t index{ offset }; index < members.values.size() && limit > 0; ++index, --limit)
+                {
+                    visit(base | members.values[index]);
+                }
+
+                offset = 0;
+                continue;
+            }
+
+            for (std::size_t word{}; word < bitmapWords && limit > 0; ++word)
+            {
+                std::uint64_t bits{ members.bits[word] };
+                std::size_t ones{ static_cast<std::size_t>(std::popcount(bits)) };
+
+                if (offset >= ones)
+                {
+                    offset -= ones;
+                    continue;
+                }
+
+                for (; bits != 0 && limit > 0; bits &= bits - 1)
+                {
+                    if (offset > 0)
+                    {
+                        --offset;
+                        continue;
+                    }
+
+                    visit(base | static_cast<unsigned>(word * 64 + static_cast<std::size_t>(std::countr_zero(bits))));
+                    --limit;
+                }
+            }
+
+            offset = 0;
+        }
+    }
+
+    // Bytes held by the groups.
+    std::size_t memoryUsage() const;
+
+    void clear();
+
+private:
+    static constexpr std::size_t arrayLimit{ 4096 };
+    static constexpr std::size_t bitmapWords{ 65536 / 64 };
+
+    // The members sharing upper 16 bits `high`.
+    struct Group
+    {
+        std::uint16_t high;
+        std::size_t count{};
+        std::vector<std::uint16_t> values{};    // Sorted, while not a bitmap.
+        std::vector<std::uint64_t> bits{};      // bitmapWords words, or empty.
+
+        bool isBitmap() const { return !bits.empty(); }
+    };
+
+    // Position of the first group whose `high` is not below `high`.
+    std::size_t groupOf(std::uint16_t high) const;
+
+    static void toBitmap(Group &group);
+    static void toArray(Group &group);
+
+    std::vector<Group> m_groups;    // Sorted by `high`.
+    std::size_t m_size{};
+};
+
+#endif
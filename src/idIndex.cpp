@@ -0,0 +1,150 @@
+//******************************************************************************
+//File Name: idIndex.cpp
+//Description: Implementation for IdIndex object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "idIndex.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+constexpr std::size_t minimumCapacity{ 16 };
+
+} // anonymous namespace
+
+std::uint32_t IdIndex::find(unsigned id) const
+{
+    std::size_t slot{ slotOf(id) };
+    return slot == m_slots.size() ? npos : m_slots[slot].position;
+}
+
+bool IdIndex::insert(unsigned id, std::uint32_t position)
+{
+    if ((m_count + 1) * 2 > m_slots.size())
+    {
+        rehash(std::max(m_slots.size() * 2, minimumCapacity));
+    }
+
+    std::size_t const mask{ m_slots.size() - 1 };
+
+    for (std::size_t slot{ home(id) }; ; slot = (slot + 1) & mask)
+    {
+        if (m_slots[slot].position == npos)
+        {
+            m_slots[slot] = { id, position };
+            ++m_count;
+            return true;
+        }
+
+        if (m_slots[slot].id == id)
+        {
+            return false;
+        }
+    }
+}
+
+void IdIndex::assign(unsigned id, std::uint32_t position)
+{
+    std::size_t slot{ slotOf(id) };
+
+    if (slot != m_slots.size())
+    {
+        m_slots[slot].position = position;
+    }
+}
+
+void IdIndex::erase(unsigned id)
+{
+    std::size_t hole{ slotOf(id) };
+
+    if (hole == m_slots.size())
+    {
+        return;
+    }
+
+    // Shift later members of the probe sequence back into the hole so that no
+    // lookup is cut short by the now empty slot.
+    std::size_t const mask{ m_slots.size() - 1 };
+
+    for (std::size_t slot{ (hole + 1) & mask }; m_slots[slot].position != npos; slot = (slot + 1) & mask)
+    {
+        std::size_t wanted{ home(m_slots[slot].id) };
+
+        // The entry may move only if its home is not cyclically within (hole, slot].
+        bool homeBetween{ hole <= slot ? (wanted > hole && wanted <= slot)
+                                       : (wanted > hole || wanted <= slot) };
+
+        if (!homeBetween)
+        {
+            m_slots[hole] = m_slots[slot];
+            hole = slot;
+        }
+    }
+
+    m_slots[hole] = Slot{};
+    --m_count;
+}
+
+void IdIndex::clear()
+{
+    m_slots.clear();
+    m_count = 0;
+    m_shift = 64;
+}
+
+void IdIndex::reserve(std::size_t count)
+{
+    if (count * 2 > m_slots.size())
+    {
+        rehash(std::max(std::bit_ceil(count * 2), minimumCapacity));
+    }
+}
+
+std::size_t IdIndex::home(unsigned id) const
+{
+    // Fibonacci hashing spreads sequential IDs across the whole table.
+    return (std::uint64_t{ id } * 0x9E3779B97F4A7C15) >> m_shift;
+}
+
+std::size_t IdIndex::slotOf(unsigned id) const
+{
+    if (m_slots.empty())
+    {
+        return 0;
+    }
+
+    std::size_t const mask{ m_slots.size() - 1 };
+
+    for (std::size_t slot{ home(id) }; m_slots[slot].position != npos; slot = (slot + 1) & mask)
+    {
+        if (m_slots[slot].id == id)
+        {
+            return slot;
+        }
+    }
+
+    return m_slots.size();
+}
+
+void IdIndex::rehash(std::size_t capacity)
+{
+    std::vector<Slot> previous{ std::exchange(m_slots, std::vector<Slot>(capacity)) };
+    m_shift = 64 - static_cast<unsigned>(std::countr_zero(capacity));
+    m_count = 0;
+
+    for (Slot const &slot : previous)
+    {
+        if (slot.position != npos)
+        {
+            insert(slot.id, slot.position);
+        }
+    }
+}
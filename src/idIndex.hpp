@@ -0,0 +1,63 @@
+//******************************************************************************
+//File Name: idIndex.hpp
+//Description: Open addressing hash index from employee ID to record position.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef ID_INDEX_HPP
+#define ID_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+// Maps employee IDs to positions in the employee store.  Uses linear probing
+// with backward shift deletion, so lookups never walk over tombstones and the
+// table stays at most half full.
+class IdIndex
+{
+public:
+    // Returned by `find` when the ID is not present.
+    static constexpr std::uint32_t npos{ std::numeric_limits<std::uint32_t>::max() };
+
+    // Position of the record with `id`, or npos.
+    std::uint32_t find(unsigned id) const;
+
+    bool contains(unsigned id) const { return find(id) != npos; }
+
+    // Adds `id`, returns false (leaving the index unchanged) if it is present.
+    bool insert(unsigned id, std::uint32_t position);
+
+    // Updates the position of an ID that is already present.
+    void assign(unsigned id, std::uint32_t position);
+
+    // Removes `id` if present.
+    void erase(unsigned id);
+
+    void clear();
+
+    // Sizes the table for `count` IDs without further rehashing.
+    void reserve(std::size_t count);
+
+    std::size_t size() const { return m_count; }
+
+private:
+    struct Slot
+    {
+        unsigned id;
+        std::uint32_t position{ npos };  // npos marks an empty slot.
+    };
+
+    std::size_t home(unsigned id) const;
+    std::size_t slotOf(unsigned id) const;
+    void rehash(std::size_t capacity);
+
+    std::vector<Slot> m_slots;
+    std::size_t m_count{};
+    unsigned m_shift{ 64 };
+};
+
+#endif
@@ -6,11 +6,190 @@
 //******************************************************************************
 
 #include "managementInformationSystem.hpp"
+#include "operationStatistics.hpp"
 
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <print>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
 
-int main()
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+[[noreturn]]
+void usage(std::string_view program)
+{
+    std::println("Usage: {} [--database=<path>] [--load=stream|mapped|parallel|lazy] [--output=auto|line|bulk]"
+                 " [--snapshot=<path> [--build-snapshot]] [--log=<path>]"
+                 " [--save-interval=<seconds>] [--memory-budget=<MiB>] [--statistics=<path>] [--batch=<path>|-|--serve=<socket>]", program);
+    std::exit(1);
+}
+
+unsigned parseUnsigned(std::string_view text, std::string_view program)
+{
+    unsigned value{};
+    auto [end, error]{ std::from_chars(text.data(), text.data() + text.size(), value) };
+
+    if (error != std::errc{} || end != text.data() + text.size())
+    {
+        usage(program);
+    }
+
+    return value;
+}
+
+struct CommandLine
+{
+    SystemOptions options;
+    bool buildSnapshot{ false };
+    std::optional<std::filesystem::path> batch;
+    std::optional<std::filesystem::path> serve;
+    std::optional<std::filesystem::path> statistics;  // Written on exit.
+};
+
+CommandLine parseCommandLine(std::span<char *> args)
 {
-    ManagementInformationSystem system;
+    CommandLine commandLine;
+    SystemOptions &options{ commandLine.options };
+
+    for (std::string_view arg : args.subspan(1))
+    {
+        if (arg.starts_with("--database="))
+        {
+            options.database = arg.substr(arg.find('=') + 1);
+        }
+        else if (arg == "--load=stream")
+        {
+            options.loadMode = LoadMode::stream;
+        }
+        else if (arg == "--load=mapped")
+        {
+            options.loadMode = LoadMode::mapped;
+        }
+        else if (arg == "--load=parallel")
+        {
+            options.loadMode = LoadMode::parallel;
+        }
+        else if (arg == "--load=lazy")
+        {
+            options.loadMode = LoadMode::lazy;
+        }
+        else if (arg == "--output=auto")
+        {
+            options.outputMode = OutputMode::automatic;
+        }
+        else if (arg == "--output=line")
+        {
+            options.outputMode = OutputMode::line;
+        }
+        else if (arg == "--output=bulk")
+        {
+            options.outputMode = OutputMode::bulk;
+        }
+        else if (arg.starts_with("--snapshot="))
+        {
+            options.snapshot = arg.substr(arg.find('=') + 1);
+        }
+        else if (arg.starts_with("--log="))
+        {
+            options.operationLog = arg.substr(arg.find('=') + 1);
+        }
+        else if (arg.starts_with("--save-interval="))
+        {
+            options.saveInterval = std::chrono::seconds{ parseUnsigned(arg.substr(arg.find('=') + 1), args.front()) };
+        }
+        else if (arg.starts_with("--memory-budget="))
+        {
+            options.memoryBudget = std::size_t{ parseUnsigned(arg.substr(arg.find('=') + 1), args.front()) } << 20;
+        }
+        else if (arg.starts_with("--batch="))
+        {
+            commandLine.batch = arg.substr(arg.find('=') + 1);
+        }
+        else if (arg.starts_with("--serve="))
+        {
+            commandLine.serve = arg.substr(arg.find('=') + 1);
+        }
+        else if (arg.starts_with("--statistics="))
+        {
+            commandLine.statistics = arg.substr(arg.find('=') + 1);
+        }
+        else if (arg == "--build-snapshot")
+        {
+            commandLine.buildSnapshot = true;
+        }
+        else
+        {
+            usage(args.front());
+        }
+    }
+
+    if (commandLine.buildSnapshot && options.snapshot.empty())
+    {
+        usage(args.front());
+    }
+
+    // Only one of the modes other than the interactive menus may be chosen.
+    if (commandLine.buildSnapshot + commandLine.batch.has_value() + commandLine.serve.has_value() > 1)
+    {
+        usage(args.front());
+    }
+
+    // Batch commands run against the fully loaded database, which a memory
+    // budget is meant to avoid.
+    if (commandLine.batch && options.memoryBudget > 0)
+    {
+        usage(args.front());
+    }
+
+    return commandLine;
+}
+
+// Runs the mode chosen on the command line, returns whether it succeeded.
+bool run(ManagementInformationSystem &system, CommandLine const &commandLine)
+{
+    if (commandLine.buildSnapshot)
+    {
+        return system.buildSnapshot();
+    }
+
+    if (commandLine.batch)
+    {
+        return system.runBatch(*commandLine.batch);
+    }
+
+    if (commandLine.serve)
+    {
+        return system.serve(*commandLine.serve);
+    }
+
     system.login();
+    return true;
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    CommandLine commandLine{ parseCommandLine({ argv, static_cast<std::size_t>(argc) }) };
+    ManagementInformationSystem system{ std::move(commandLine.options) };
+
+    bool succeeded{ run(system, commandLine) };
+
+    if (commandLine.statistics && !writeStatistics(*commandLine.statistics, system.statistics()))
+    {
+        std::println(stderr, "Failed to write statistics to {}", commandLine.statistics->string());
+        succeeded = false;
+    }
+
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
 }
-    
@@ -6,16 +6,36 @@
 //******************************************************************************
 
 #include "managementInformationSystem.hpp"
+#include "batchMode.hpp"
+#include "boundedEmployeeDatabase.hpp"
+#include "bulkWriter.hpp"
+#include "console.hpp"
+#include "employeeDatabase.hpp"
+#include "employeeFileIndex.hpp"
+#include "employeeLoader.hpp"
+#include "employeeQuery.hpp"
 #include "employees.hpp"
+#include "operationLog.hpp"
+#include "operationStatistics.hpp"
+#include "roles.hpp"
+#include "sessionServer.hpp"
+#include "sharedEmployeeDatabase.hpp"
+#include "snapshot.hpp"
+
+#include <unistd.h>
 
 #include <algorithm>
-#include <cstdlib>
-#include <filesystem>
-#include <fstream>
-#include <iostream>
-#include <limits>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <optional>
 #include <print>
-#include <ranges>
 #include <span>
 #include <string>
 #include <string_view>
@@ -28,265 +48,455 @@ namespace
 
 void clearScreen()
 {
-    std::system("clear");
+    currentConsole().clear();
 }
 
 void clearScreenWhenReady()
 {
-    std::println("Press `Enter` to continue...");
-    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    consolePrintln("Press `Enter` to continue...");
+
+    std::string ignored;
+    consoleReadLine(ignored);
+
     clearScreen();
 }
 
-[[noreturn]]
-void invalidInput(std::string_view line)
+// Prompts for credentials until they match a record, returning its handle,
+// or nullopt if the record is removed while signing in.
+std::optional<EmployeeHandle> requestUserLogin(SharedEmployeeDatabase const &employees)
 {
-    std::println("Invalid input encountered!");
-    std::println("Found: {}", line);
-    std::exit(1);
-}
+    std::string input;
+    unsigned id{};
 
-unsigned parseField(std::string_view field, std::string_view line)
-{
-    unsigned value{};
+    consolePrintln("Please enter your credentials.");
 
-    if (!(std::from_chars(field.data(), field.data() + field.size(), value).ec == std::errc{}))
-    {
-        invalidInput(line);
-    }
+    std::optional<EmployeeHandle> handle;
 
-    return value;
-}
+    while (!handle)
+    {
+        consolePrint("Enter Employee Number: ");
+        consoleReadLine(input);
 
-std::unique_ptr<Employee> makeEmployee(std::string_view line)
-{
-    auto fields{ line | std::views::split(',')
-        | std::views::transform([](auto&& split_view)
-                                { return std::string_view{ split_view }; }) };
+        if (!(std::from_chars(input.data(), input.data() + input.size(), id).ec == std::errc{}))
+        {
+            consolePrintln("Please enter a valid ID number.");
+            continue;
+        }
 
-    auto fieldsIter = fields.begin();
+        std::shared_ptr<EmployeeDatabase const> version{ employees.read() };
 
-    auto nextField{ [&fieldsIter, &fields, line]()
+        if (auto employee{ version->find(id) })
         {
-            if (fieldsIter == fields.end())
-            { 
-                invalidInput(line);
-            }
-            return *fieldsIter++;
-        }};
+            handle = employee->handle();
+        }
+        else
+        {
+            consolePrintln("Employee id \"{}\" was not found.", input);
+        }
+    }
 
-    Employee::EmployeeBuilder params{
-        .id = parseField(nextField(), line),
-        .name{ nextField() },
-        .password{ nextField()}
-    };
+    while (true)
+    {
+        consolePrint("Enter password for ID {}: ", id);
+        consoleReadLine(input);
 
-    auto type{ nextField() };
+        OperationTimer timer{ Operation::login };
+        std::shared_ptr<EmployeeDatabase const> version{ employees.read() };
+        std::optional<Employee> employee{ version->find(*handle) };
 
-    if (type == "GeneralEmployee")
-    {
-        return std::make_unique<GeneralEmployee>(params);
-    }
-    else if (type == "HumanResourcesEmployee")
-    {
-        return std::make_unique<HumanResourcesEmployee>(params);
-    }
-    else if (type == "ManagerEmployee")
-    {
-        return std::make_unique<ManagerEmployee>(params);
+        if (!employee)
+        {
+            consolePrintln("Employee ID {} has been removed.", id);
+            return std::nullopt;
+        }
+
+        if (employee->isCorrectPassword(input))
+        {
+            clearScreen();
+            return handle;
+        }
+        else
+        {
+            consolePrintln("Password incorrect.");
+        }
     }
 
-    invalidInput(line);
+    return std::nullopt;  // Should never get here.
 }
 
-std::vector<std::unique_ptr<Employee>> populateEmployeesFromFile(std::filesystem::path pathToCSV)
+// Credentials accepted by the database file, see loginWhileLoading.
+struct Credentials
 {
-    std::vector<std::unique_ptr<Employee>> employees;
+    unsigned id;
+    std::string password;
+};
 
-    if (!std::filesystem::exists(pathToCSV))
-    {
-        std::println("Employee database not found at {}", pathToCSV.string());
-        return employees;
-    }
+// As above, but checks credentials against records parsed from the database
+// file as they are asked for.
+Credentials requestUserLogin(EmployeeFileIndex const &index)
+{
+    std::string input;
+    unsigned id{};
 
-    std::fstream file{ pathToCSV };
+    consolePrintln("Please enter your credentials.");
 
-    if (!file.is_open())
+    while (true)
     {
-        std::println("Failed to open employee database file, {}", pathToCSV.string());
-        return employees;
-    }
+        consolePrint("Enter Employee Number: ");
+        consoleReadLine(input);
 
-    std::string line;
-    std::getline(file, line);  // Skip CSV header.
+        if (!(std::from_chars(input.data(), input.data() + input.size(), id).ec == std::errc{}))
+        {
+            consolePrintln("Please enter a valid ID number.");
+            continue;
+        }
 
-    while (std::getline(file, line))
-    {
-        employees.push_back(makeEmployee(line));
+        if (index.contains(id))
+        {
+            break;
+        }
+
+        consolePrintln("Employee id \"{}\" was not found.", input);
     }
 
-    return employees;
-}
+    while (true)
+    {
+        consolePrint("Enter password for ID {}: ", id);
+        consoleReadLine(input);
 
-Employee *getUserIfPresentOrNull(std::span<std::unique_ptr<Employee> const> employees, unsigned id)
-{
-    auto found{ std::ranges::find_if(employees, [id](std::unique_ptr<Employee> const &employee)
-                         {
-                            return employee->getID() == id;
-                         }) };
+        OperationTimer timer{ Operation::login };
+        EmployeeStore record;
 
-    if (found != employees.end())
-    {
-        return found->get();
-    }
+        if (index.find(id, record)->isCorrectPassword(input))
+        {
+            clearScreen();
+            return { id, std::move(input) };
+        }
 
-    return nullptr;
+        consolePrintln("Password incorrect.");
+    }
 }
 
-Employee *requestUserLogin(std::span<std::unique_ptr<Employee>> employees)
+// As above, for the bounded memory database, whose users are identified by
+// ID, or nullopt if the record is removed while signing in.
+std::optional<unsigned> requestUserLogin(BoundedEmployeeDatabase const &employees)
 {
     std::string input;
     unsigned id{};
 
-    std::println("Please enter your credentials.");
-
-    Employee *employee{ nullptr };
+    consolePrintln("Please enter your credentials.");
 
-    while (!employee)
+    while (true)
     {
-        std::print("Enter Employee Number: ");
-        std::getline(std::cin, input);
+        consolePrint("Enter Employee Number: ");
+        consoleReadLine(input);
 
         if (!(std::from_chars(input.data(), input.data() + input.size(), id).ec == std::errc{}))
         {
-            std::println("Please enter a valid ID number.");
+            consolePrintln("Please enter a valid ID number.");
             continue;
         }
 
-        employee = getUserIfPresentOrNull(employees, id);
-
-        if (!employee)
+        if (employees.contains(id))
         {
-            std::println("Employee id \"{}\" was not found.", input);
+            break;
         }
+
+        consolePrintln("Employee id \"{}\" was not found.", input);
     }
 
     while (true)
     {
-        std::print("Enter password for ID {}: ", employee->getID());
-        std::getline(std::cin, input);
+        consolePrint("Enter password for ID {}: ", id);
+        consoleReadLine(input);
 
-        if (employee->isCorrectPassword(input))
+        OperationTimer timer{ Operation::login };
+        std::optional<EmployeeRecord> employee{ employees.find(id) };
+
+        if (!employee)
         {
-            clearScreen();
-            return employee;
+            consolePrintln("Employee ID {} has been removed.", id);
+            return std::nullopt;
         }
-        else
+
+        if (employee->isCorrectPassword(input))
         {
-            std::println("Password incorrect.");
+            clearScreen();
+            return id;
         }
-    }
 
-    return nullptr;  // Should never get here.
+        consolePrintln("Password incorrect.");
+    }
 }
 
 unsigned getIdFromConsole()
 {
-    std::print("Enter an employee ID: ");
+    consolePrint("Enter an employee ID: ");
 
     std::string line;
     unsigned id{};
 
     while (true)
     {
-        std::getline(std::cin, line);
+        consoleReadLine(line);
 
         if (std::from_chars(line.data(), line.data() + line.size(), id).ec == std::errc{})
         {
             return id;
         }
 
-        std::println("{} is not a valid id.", line);
+        consolePrintln("{} is not a valid id.", line);
     }
 }
 
 std::string getStringArgFromConsole(std::string_view arg)
 {
-    std::print("Enter an employee {}: ", arg);
+    consolePrint("Enter an employee {}: ", arg);
 
     std::string line;
-    std::getline(std::cin, line);
+    consoleReadLine(line);
 
     return line;
 }
 
-void searchByID(std::span<std::unique_ptr<Employee> const> employees)
+// Reads a name or password, asking again until it satisfies isValidField.
+std::string getFieldFromConsole(std::string_view arg)
 {
-    unsigned id{ getIdFromConsole() };
+    while (true)
+    {
+        std::string field{ getStringArgFromConsole(arg) };
+
+        if (isValidField(field))
+        {
+            return field;
+        }
+
+        consolePrintln("An employee {} may be at most {} characters long and may not contain commas, try again.",
+                       arg, maxFieldLength);
+    }
+}
 
-    auto found{ std::ranges::find_if(employees, [id](std::unique_ptr<Employee> const &employee)
-                         {
-                            return employee->getID() == id;
-                         }) };
+Role getRoleFromConsole()
+{
+    while (true)
+    {
+        std::string type{ getStringArgFromConsole("employee type") };
+
+        if (auto role{ parseRole(type) })
+        {
+            return *role;
+        }
+
+        consolePrintln("{} is not a valid employee type, try again.", type);
+    }
+}
+
+template<typename Employees>
+void searchByID(Employees const &employees)
+{
+    unsigned id{ getIdFromConsole() };
 
-    if (found == employees.end())
     {
+        OperationTimer timer{ Operation::search };
+        auto version{ employees.read() };
+        auto found{ version->find(id) };
+
         clearScreen();
-        std::println("Employee ID: \"{}\" was not found in the database.", id);
-        clearScreenWhenReady();
-        return;
+
+        if (!found)
+        {
+            consolePrintln("Employee ID: \"{}\" was not found in the database.", id);
+        }
+        else
+        {
+            consolePrintln("Found:\n{}", *found);
+        }
     }
 
-    clearScreen();
-    std::println("Found:\n{}", **found);
     clearScreenWhenReady();
 }
 
-void searchByName(std::span<std::unique_ptr<Employee> const> employees)
+template<typename Employees>
+void searchByName(Employees const &employees)
 {
     std::string name{ getStringArgFromConsole("name") };
 
-    auto nameIs{ [&name](std::unique_ptr<Employee> const &employee)
-                         {
-                            return employee->getName() == name;
-                         } };
+    {
+        OperationTimer timer{ Operation::search };
+        auto version{ employees.read() };
+        auto found{ version->findByName(name) };
+
+        clearScreen();
+
+        if (found.empty())
+        {
+            consolePrintln("Employee \"{}\" was not found in the database.", name);
+        }
+        else
+        {
+            consolePrintln("Found:\n");
+
+            for (unsigned id : found)
+            {
+                if (auto employee{ version->find(id) })
+                {
+                    consolePrintln("{}\n", *employee);
+                }
+            }
+        }
+    }
+
+    clearScreenWhenReady();
+}
 
-    auto found{ std::ranges::find_if(employees, nameIs) };
+template<typename Employees>
+void searchByNamePrefix(Employees const &employees)
+{
+    std::string prefix{ getStringArgFromConsole("name prefix") };
+
+    clearScreen();
 
-    if (found == employees.end())
     {
-        clearScreen();
-        std::println("Employee \"{}\" was not found in the database.", name);
-        clearScreenWhenReady();
-        return;
+        OperationTimer timer{ Operation::search };
+        bool anyFound{ false };
+
+        employees.read()->forEachWithNamePrefix(prefix, [&anyFound](auto const &employee)
+            {
+                if (!anyFound)
+                {
+                    consolePrintln("Found:\n");
+                    anyFound = true;
+                }
+
+                consolePrintln("{}\n", employee);
+            });
+
+        if (!anyFound)
+        {
+            consolePrintln("No employee names starting with \"{}\" were found in the database.", prefix);
+        }
+    }
+
+    clearScreenWhenReady();
+}
+
+template<typename Employees>
+void searchByQuery(Employees const &employees)
+{
+    std::optional<EmployeeQuery> query;
+
+    consolePrintln("Conditions on id, name and title joined by `and`, e.g.\n"
+                   "title = ManagerEmployee and name starts with 'D' and id between 1000 and 5000");
+
+    while (!query)
+    {
+        consolePrint("Enter a query: ");
+
+        std::string text;
+        std::string_view error;
+        consoleReadLine(text);
+
+        query = EmployeeQuery::compile(text, error);
+
+        if (!query)
+        {
+            consolePrintln("Invalid query: {}.", error);
+        }
     }
 
     clearScreen();
-    std::println("Found:\n");
 
-    for (auto const &each : employees | std::views::filter(nameIs))
     {
-         std::println("{}\n", *each);
+        OperationTimer timer{ Operation::search };
+        auto version{ employees.read() };
+        auto found{ version->select(*query) };
+
+        if (found.empty())
+        {
+            consolePrintln("No employees match the query.");
+        }
+        else
+        {
+            consolePrintln("Found {} employees:\n", found.size());
+
+            for (auto const &employee : found)
+            {
+                consolePrintln("{}\n", employee);
+            }
+        }
     }
 
     clearScreenWhenReady();
 }
 
+// Same output as the line by line listing in viewEmployees, but rendered into
+// large chunks, with the rendering rate reported on standard error.
+template<typename Employees>
+void printAllEmployeesInBulk(Employees const &employees)
+{
+    auto start{ std::chrono::steady_clock::now() };
+
+    {
+        BulkWriter output{ STDOUT_FILENO };
+
+        output.println("************ ALL EMPLOYEES ************");
+
+        employees.forEach([&output](auto const &employee)
+            {
+                output.println("{}", employee);
+            });
+
+        output.println("***************************************");
+    }
+
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+    double records{ static_cast<double>(employees.size()) };
+
+    std::println(stderr, "Rendered {} records in {:.3f} ms ({:.0f} records/s).",
+                 employees.size(), elapsed.count() * 1000.0, records / elapsed.count());
+}
+
+// Everything remaining on standard input, read directly rather than through
+// std::cin, which nothing else uses in batch mode.
+std::string readStandardInput()
+{
+    std::string contents;
+    std::array<char, 1 << 16> chunk;
+
+    while (true)
+    {
+        ssize_t result{ ::read(STDIN_FILENO, chunk.data(), chunk.size()) };
+
+        if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (result <= 0)
+        {
+            return contents;
+        }
+
+        contents.append(chunk.data(), static_cast<std::size_t>(result));
+    }
+}
 
 void nope()
 {
-    std::println("User does not have permission to perform this action.");
+    consolePrintln("User does not have permission to perform this action.");
 }
 
-void searchEmployeesBy(std::span<std::unique_ptr<Employee> const> employees)
+template<typename Employees>
+void searchEmployeesBy(Employees const &employees)
 {
     std::string line;
 
     while (true)
     {
-        std::println("Select search type:\n1. Search by name.\n2. Search by ID.");
+        consolePrintln("Select search type:\n1. Search by name.\n2. Search by ID.\n3. Search by name prefix.\n"
+                       "4. Search by query.");
 
-        std::getline(std::cin, line);
+        consoleReadLine(line);
 
         if (line == "1")
         {
@@ -300,43 +510,251 @@ void searchEmployeesBy(std::span<std::unique_ptr<Employee> const> employees)
             return searchByID(employees);
         }
 
-        std::println("Invalid selection.");
-    }
+        if (line == "3")
+        {
+            clearScreen();
+            return searchByNamePrefix(employees);
+        }
+
+        if (line == "4")
+        {
+            clearScreen();
+            return searchByQuery(employees);
+        }
+
+        consolePrintln("Invalid selection.");
+    }
+}
+
+// Employees listed per page when browsing.
+constexpr std::size_t browsePageSize{ 20 };
+
+// Pages through `count(version)` employees, listed from the latest version
+// by `list(version, offset, limit, print)`, until the user returns.
+template<typename Count, typename List>
+void pageEmployees(SharedEmployeeDatabase const &employees, Count &&count, List &&list)
+{
+    std::string line;
+    std::size_t page{};
+
+    while (true)
+    {
+        std::size_t pages{};
+
+        {
+            OperationTimer timer{ Operation::view };
+            std::shared_ptr<EmployeeDatabase const> version{ employees.read() };
+            std::size_t listed{ count(*version) };
+
+            pages = std::max<std::size_t>((listed + browsePageSize - 1) / browsePageSize, 1);
+            page = std::min(page, pages - 1);
+
+            consolePrintln("Page {} of {}, {} employees:\n", page + 1, pages, listed);
+
+            list(*version, page * browsePageSize, browsePageSize,
+                 [](Employee const &employee) { consolePrintln("{}", employee); });
+        }
+
+        consolePrintln("Enter `n` for the next page, `p` for the previous page, a page number, or nothing to return.");
+        consoleReadLine(line);
+        clearScreen();
+
+        std::size_t selected{};
+
+        if (line == "n")
+        {
+            page = std::min(page + 1, pages - 1);
+        }
+        else if (line == "p")
+        {
+            page = page > 0 ? page - 1 : 0;
+        }
+        else if (std::from_chars(line.data(), line.data() + line.size(), selected).ec == std::errc{} && selected > 0)
+        {
+            page = selected - 1;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+// Pages through the employees in an order chosen by the user, or within a
+// range of IDs.  Every page is read from the latest version, each in
+// O(log n + browsePageSize) however far into the order it is.
+void browseEmployeesBy(SharedEmployeeDatabase const &employees)
+{
+    std::string line;
+    EmployeeOrder order{ EmployeeOrder::id };
+    std::optional<std::pair<unsigned, unsigned>> range;
+
+    while (true)
+    {
+        consolePrintln("Select an order:\n1. By ID.\n2. By name.\n3. By title.\n4. By ID, within a range of IDs.");
+
+        consoleReadLine(line);
+
+        if (line == "1" || line == "2" || line == "3")
+        {
+            order = EmployeeOrder{ static_cast<std::uint8_t>(line[0] - '1') };
+            break;
+        }
+
+        if (line == "4")
+        {
+            consolePrintln("Enter the first and last IDs of the range.");
+
+            unsigned first{ getIdFromConsole() };
+            range = { first, getIdFromConsole() };
+            break;
+        }
+
+        consolePrintln("Invalid selection.");
+    }
+
+    clearScreen();
+
+    if (range)
+    {
+        auto [low, high]{ *range };
+
+        pageEmployees(employees,
+                      [low, high](EmployeeDatabase const &version) { return version.countInIDRange(low, high); },
+                      [low, high](EmployeeDatabase const &version, std::size_t offset, std::size_t limit, auto print)
+                      {
+                          version.forEachInIDRange(low, high, offset, limit, print);
+                      });
+    }
+    else
+    {
+        pageEmployees(employees,
+                      [](EmployeeDatabase const &version) { return version.size(); },
+                      [order](EmployeeDatabase const &version, std::size_t offset, std::size_t limit, auto print)
+                      {
+                          version.forEachInOrder(order, offset, limit, print);
+                      });
+    }
+}
+
+// Shows the headcount of every title, each read in O(1), then pages through
+// the employees with a title chosen by the user in order of ID.
+void reportEmployeesBy(SharedEmployeeDatabase const &employees)
+{
+    {
+        OperationTimer timer{ Operation::view };
+        std::shared_ptr<EmployeeDatabase const> version{ employees.read() };
+
+        consolePrintln("Headcount by title:\n");
+
+        for (std::size_t role{}; role < roleCount; ++role)
+        {
+            consolePrintln("{}. {}: {}", role + 1, roleTable[role].title,
+                           version->countWithRole(Role{ static_cast<std::uint8_t>(role) }));
+        }
+
+        consolePrintln("\nTotal: {}\n", version->size());
+    }
+
+    std::string line;
+    std::size_t selected{};
+
+    while (true)
+    {
+        consolePrintln("Enter a title's number to list its employees, or nothing to return.");
+        consoleReadLine(line);
+
+        if (line.empty())
+        {
+            clearScreen();
+            return;
+        }
+
+        if (std::from_chars(line.data(), line.data() + line.size(), selected).ec == std::errc{}
+            && selected > 0 && selected <= roleCount)
+        {
+            break;
+        }
+
+        consolePrintln("Invalid selection.");
+    }
+
+    clearScreen();
+
+    Role role{ static_cast<std::uint8_t>(selected - 1) };
+
+    pageEmployees(employees,
+                  [role](EmployeeDatabase const &version) { return version.countWithRole(role); },
+                  [role](EmployeeDatabase const &version, std::size_t offset, std::size_t limit, auto print)
+                  {
+                      version.forEachWithRole(role, offset, limit, print);
+                  });
+}
+
+// Bounded memory mode keeps no ordered indexes to page through.
+void browseEmployeesBy(BoundedEmployeeDatabase const &)
+{
+    consolePrintln("Browsing in order is not available in bounded memory mode, as it needs every record loaded.");
+    clearScreenWhenReady();
+}
+
+// Nor does it keep the employees with each role.
+void reportEmployeesBy(BoundedEmployeeDatabase const &)
+{
+    consolePrintln("Headcount reports are not available in bounded memory mode, as they need every record loaded.");
+    clearScreenWhenReady();
+}
+
+// Commits `change` as SharedEmployeeDatabase::write does, timed as one
+// `operation`, including any wait for other users' commits.
+template<typename Employees, typename Change>
+auto timedWrite(Employees &employees, Operation operation, Change &&change)
+{
+    OperationTimer timer{ operation };
+    return employees.write(std::forward<Change>(change));
+}
+
+// Formats the employee with `id` for display once a commit has changed it.
+template<typename Employees>
+std::string describeEmployee(Employees const &employees, unsigned id)
+{
+    return std::format("{}", *employees.find(id));
 }
 
-void removeCurrentEmployee(std::vector<std::unique_ptr<Employee>> &employees)
+template<typename Employees>
+void removeCurrentEmployee(Employees &employees)
 {
     unsigned id{ getIdFromConsole() };
 
-    auto idIs{ [id](std::unique_ptr<Employee> const &employee)
-                         {
-                            return employee->getID() == id;
-                         } };
+    std::optional<std::string> removed{ timedWrite(employees, Operation::remove,
+                                                    [id](auto &master) -> std::optional<std::string>
+        {
+            if (!master.contains(id))
+            {
+                return std::nullopt;
+            }
+
+            std::string description{ describeEmployee(master, id) };
+            master.remove(id);
 
-    auto found{ std::ranges::find_if(employees, idIs) };
+            return description;
+        }) };
 
-    if (found == employees.end())
+    if (!removed)
     {
         clearScreen();
-        std::println("Employee ID: \"{}\" was not found in the database.", id);
+        consolePrintln("Employee ID: \"{}\" was not found in the database.", id);
         clearScreenWhenReady();
         return;
     }
 
-    std::println("Employee:\n\n{}\nhas been removed from the database.\n", **found);
-
-    std::erase_if(employees, idIs);
+    consolePrintln("Employee:\n\n{}\nhas been removed from the database.\n", *removed);
 
     clearScreenWhenReady();
 }
 
-bool contains(std::span<std::unique_ptr<Employee> const> employees, unsigned const id)
-{
-    return std::ranges::find_if( employees, [id](std::unique_ptr<Employee> const &employee)
-        { return employee->getID() == id; } ) != employees.end();
-}
-
-unsigned getValidId(std::span<std::unique_ptr<Employee> const> employees)
+template<typename Employees>
+unsigned getValidId(Employees const &employees)
 {
     unsigned id{};
 
@@ -344,9 +762,9 @@ unsigned getValidId(std::span<std::unique_ptr<Employee> const> employees)
     {
         id = getIdFromConsole();
 
-        if (contains(employees, id))
+        if (employees.read()->contains(id))
         {
-            std::println("ID {} already exists in the database, try again.", id);
+            consolePrintln("ID {} already exists in the database, try again.", id);
         }
         else
         {
@@ -355,42 +773,41 @@ unsigned getValidId(std::span<std::unique_ptr<Employee> const> employees)
     }
 }
 
-void addNewEmployee(std::vector<std::unique_ptr<Employee>> &employees)
+template<typename Employees>
+void addNewEmployee(Employees &employees)
 {
     unsigned id{ getValidId(employees) };
-    std::string name{ getStringArgFromConsole("name") };
-    std::string password{ getStringArgFromConsole("password") };
+    std::string name{ getFieldFromConsole("name") };
+    std::string password{ getFieldFromConsole("password") };
+    Role role{ getRoleFromConsole() };
 
-    std::string type;
-
-    while (true)
-    {
-        type = getStringArgFromConsole("employee type");
-        
-        if (type == "GeneralEmployee")
-        {
-            employees.push_back(std::make_unique<GeneralEmployee>(Employee::EmployeeBuilder{ id, name, password }));
-            break;
-        }
-        else if (type == "HumanResourcesEmployee")
-        {
-            employees.push_back(std::make_unique<HumanResourcesEmployee>(Employee::EmployeeBuilder{ id, name, password }));
-            break;
-        }
-        else if (type == "ManagerEmployee")
+    // Another user may have taken the ID while this one was being entered.
+    std::optional<std::string> added{ timedWrite(employees, Operation::add,
+                                                  [&](auto &master) -> std::optional<std::string>
         {
-            employees.push_back(std::make_unique<ManagerEmployee>(Employee::EmployeeBuilder{ id, name, password }));
-            break;
-        }
+            if (master.contains(id))
+            {
+                return std::nullopt;
+            }
+
+            master.add(EmployeeBuilder{ id, name, password, role });
 
-        std::println("{} is not a valid employee type, try again.", type);
+            return describeEmployee(master, id);
+        }) };
+
+    if (!added)
+    {
+        consolePrintln("ID {} was added by another user meanwhile, the employee was not added.", id);
+        clearScreenWhenReady();
+        return;
     }
 
-    std::println("Employee:\n\n{}\nhas been added to the database.\n", *employees.back());
+    consolePrintln("Employee:\n\n{}\nhas been added to the database.\n", *added);
     clearScreenWhenReady();
 }
 
-unsigned getExistingEmployeeId(std::span<std::unique_ptr<Employee> const> employees)
+template<typename Employees>
+unsigned getExistingEmployeeId(Employees const &employees)
 {
     unsigned id{};
 
@@ -398,18 +815,15 @@ unsigned getExistingEmployeeId(std::span<std::unique_ptr<Employee> const> employ
     {
         id = getIdFromConsole();
 
-        auto found{ std::ranges::find_if(employees, [id](std::unique_ptr<Employee> const &employee)
-                                         {
-                                             return employee->getID() == id;
-                                         }) };
+        auto version{ employees.read() };
 
-        if (found != employees.end())
+        if (auto found{ version->find(id) })
         {
-            std::println("Found employee:\n\n{}", **found);
+            consolePrintln("Found employee:\n\n{}", *found);
             return id;
         }
 
-        std::println("Employee ID: \"{}\" was not found in the database.", id);
+        consolePrintln("Employee ID: \"{}\" was not found in the database.", id);
     }
 }
 
@@ -425,14 +839,14 @@ enum struct Field : unsigned
 
 Field selectFieldToModify()
 {
-    std::println("Select a field to modify.\n1. ID\n2. Name\n3. Password\n4. Title");
+    consolePrintln("Select a field to modify.\n1. ID\n2. Name\n3. Password\n4. Title");
 
     std::string input;
     unsigned selection{};
 
     while (true)
     {
-        std::getline(std::cin, input);
+        consoleReadLine(input);
 
         if (std::from_chars(input.data(), input.data() + input.size(), selection).ec == std::errc{})
         {
@@ -443,184 +857,388 @@ Field selectFieldToModify()
             }
         }
 
-        std::println("Invalid selection.");
+        consolePrintln("Invalid selection.");
     }
 }
 
-void modifyEmployeeId(std::vector<std::unique_ptr<Employee>> &employees, unsigned id)
+// Reports the outcome of committing a change to `field` of the employee with
+// `id`, whose updated record is nullopt if another user removed it first.
+void reportUpdate(std::string_view field, unsigned id, std::optional<std::string> const &updated)
 {
-    auto found{ std::ranges::find_if(employees, [id](std::unique_ptr<Employee> const &employee)
-                         {
-                            return employee->getID() == id;
-                         }) };
+    clearScreen();
 
-    if (found != employees.end())
+    if (updated)
     {
-        (*found)->setID(getValidId(employees));
-
-        clearScreen();
-        std::println("Employee ID updated\n\n{}\n", **found);
-        clearScreenWhenReady();
+        consolePrintln("Employee {} updated\n\n{}\n", field, *updated);
     }
     else
     {
-        // ID should already be verified before calling this function.
-        std::unreachable();
+        consolePrintln("Employee ID: \"{}\" was changed by another user meanwhile, nothing was updated.", id);
     }
+
+    clearScreenWhenReady();
+}
+
+template<typename Employees>
+void modifyEmployeeId(Employees &employees, unsigned id)
+{
+    unsigned newID{ getValidId(employees) };
+
+    reportUpdate("ID", id, timedWrite(employees, Operation::modify,
+                                      [&](auto &master) -> std::optional<std::string>
+        {
+            if (!master.contains(id) || master.contains(newID))
+            {
+                return std::nullopt;
+            }
+
+            master.changeID(id, newID);
+            return describeEmployee(master, newID);
+        }));
+}
+
+template<typename Employees>
+void modifyEmployeeName(Employees &employees, unsigned id)
+{
+    std::string name{ getFieldFromConsole("name") };
+
+    reportUpdate("name", id, timedWrite(employees, Operation::modify,
+                                        [&](auto &master) -> std::optional<std::string>
+        {
+            if (!master.contains(id))
+            {
+                return std::nullopt;
+            }
+
+            master.rename(id, name);
+            return describeEmployee(master, id);
+        }));
+}
+
+template<typename Employees>
+void modifyEmployeePassword(Employees &employees, unsigned id)
+{
+    std::string password{ getFieldFromConsole("password") };
+
+    reportUpdate("password", id, timedWrite(employees, Operation::modify,
+                                            [&](auto &master) -> std::optional<std::string>
+        {
+            if (!master.contains(id))
+            {
+                return std::nullopt;
+            }
+
+            master.changePassword(id, password);
+            return describeEmployee(master, id);
+        }));
+}
+
+template<typename Employees>
+void modifyEmployeeTitle(Employees &employees, unsigned id)
+{
+    Role role{ getRoleFromConsole() };
+
+    reportUpdate("title", id, timedWrite(employees, Operation::modify,
+                                         [&](auto &master) -> std::optional<std::string>
+        {
+            if (!master.contains(id))
+            {
+                return std::nullopt;
+            }
+
+            master.changeRole(id, role);
+            return describeEmployee(master, id);
+        }));
 }
 
-void modifyEmployeeName(std::vector<std::unique_ptr<Employee>> &employees, unsigned id)
+template<typename Employees>
+void modifyExistingEmployee(Employees &employees)
 {
-    auto found{ std::ranges::find_if(employees, [id](std::unique_ptr<Employee> const &employee)
-                         {
-                            return employee->getID() == id;
-                         }) };
+    consolePrintln("Which employee do you wish to modify?");
+
+    unsigned id{ getExistingEmployeeId(employees) };
+
+    Field field{ selectFieldToModify() };
 
-    if (found != employees.end())
+    switch (field)
     {
-        (*found)->setName(getStringArgFromConsole("name"));
+        case Field::id:
+            return modifyEmployeeId(employees, id);
+        case Field::name:
+            return modifyEmployeeName(employees, id);
+        case Field::password:
+            return modifyEmployeePassword(employees, id);
+        case Field::title:
+            return modifyEmployeeTitle(employees, id);
+        case Field::invalid: [[fallthrough]];
+        case Field::count:
+            std::unreachable();
+    }
+}
 
-        clearScreen();
-        std::println("Employee name updated\n\n{}\n", **found);
-        clearScreenWhenReady();
+} // anonymous namespace
+
+ManagementInformationSystem::~ManagementInformationSystem()
+{
+    // Other modes save in the background, see BackgroundSaver.
+    if (boundedEmployees && options.saveInterval.count() > 0)
+    {
+        boundedEmployees->save();
     }
-    else
+}
+
+void ManagementInformationSystem::login()
+{
+    openDatabase();
+
+    try
+    {
+        runSession();
+    }
+    catch (ConsoleClosed const &)
     {
-        // ID should already be verified before calling this function.
-        std::unreachable();
+        // Input ended, there is nobody left to serve.
     }
 }
 
-void modifyEmployeePassword(std::vector<std::unique_ptr<Employee>> &employees, unsigned id)
+bool ManagementInformationSystem::serve(std::filesystem::path const &socket)
+{
+    openDatabase();
+
+    SessionServer server{ socket, [this] { runSession(); } };
+    return server.run();
+}
+
+void ManagementInformationSystem::runSession()
 {
-    auto found{ std::ranges::find_if(employees, [id](std::unique_ptr<Employee> const &employee)
-                         {
-                            return employee->getID() == id;
-                         }) };
+    clearScreen();
+    consolePrintln("**************************************************************");
+    consolePrintln("Employee Management");
+    consolePrintln("**************************************************************");
+    consolePrintln();
+    consolePrintln("Please enter your credentials to login.");
 
-    if (found != employees.end())
+    if (boundedEmployees)
     {
-        (*found)->setPassword(getStringArgFromConsole("password"));
+        if (std::optional<unsigned> user{ requestUserLogin(*boundedEmployees) })
+        {
+            displayMenu(*boundedEmployees, *user);
+        }
 
-        clearScreen();
-        std::println("Employee password updated\n\n{}\n", **found);
-        clearScreenWhenReady();
+        return;
     }
-    else
+
+    std::optional<EmployeeHandle> user{ loaded.try_wait() ? requestUserLogin(employees) : loginWhileLoading() };
+
+    if (user)
     {
-        // ID should already be verified before calling this function.
-        std::unreachable();
+        displayMenu(employees, *user);
     }
 }
 
-void modifyEmployeeTitle(std::vector<std::unique_ptr<Employee>> &employees, unsigned id)
+std::optional<EmployeeHandle> ManagementInformationSystem::loginWhileLoading()
 {
-    auto idIs{ [id](std::unique_ptr<Employee> const &employee)
-                         {
-                            return employee->getID() == id;
-                         } };
+    Credentials credentials{ requestUserLogin(*fileIndex) };
+
+    if (!loaded.try_wait())
+    {
+        consolePrintln("Loading employees...");
+        loaded.wait();
+    }
+
+    // Once loaded, other users may have changed the record meanwhile.
+    std::shared_ptr<EmployeeDatabase const> version{ employees.read() };
+    std::optional<Employee> employee{ version->find(credentials.id) };
+
+    if (employee && employee->isCorrectPassword(credentials.password))
+    {
+        return employee->handle();
+    }
 
-    auto found{ std::ranges::find_if(employees, idIs) };
+    consolePrintln("Employee ID {} was changed by another user meanwhile, please sign in again.", credentials.id);
+    return requestUserLogin(employees);
+}
+
+bool ManagementInformationSystem::buildSnapshot()
+{
+    EmployeeStore store{ loadFromCSV() };
 
-    if (found == employees.end())
+    if (!writeSnapshot(store, options.snapshot, options.database))
     {
-        // ID should already be verified before calling this function.
-        std::unreachable();
+        return false;
     }
 
-    std::string name{ (*found)->getName() };
-    std::string password{ (*found)->getPassword() };
+    std::println("Wrote {} employees to {}", store.liveCount(), options.snapshot.string());
+    return true;
+}
 
+bool ManagementInformationSystem::runBatch(std::filesystem::path const &commands)
+{
+    loadDatabase();
 
-    std::string type;
+    MappedFile mapping;
+    std::string fromInput;
+    std::string_view text;
 
-    while (true)
+    if (commands == "-")
     {
-        type = getStringArgFromConsole("employee type");
-        
-        if (type == "GeneralEmployee")
-        {
-            std::erase_if(employees, idIs);
-            employees.push_back(std::make_unique<GeneralEmployee>(Employee::EmployeeBuilder{ id, name, password }));
-            break;
-        }
-        else if (type == "HumanResourcesEmployee")
-        {
-            std::erase_if(employees, idIs);
-            employees.push_back(std::make_unique<HumanResourcesEmployee>(Employee::EmployeeBuilder{ id, name, password }));
-            break;
-        }
-        else if (type == "ManagerEmployee")
+        fromInput = readStandardInput();
+        text = fromInput;
+    }
+    else
+    {
+        mapping = MappedFile{ commands };
+
+        if (!mapping.isOpen())
         {
-            std::erase_if(employees, idIs);
-            employees.push_back(std::make_unique<ManagerEmployee>(Employee::EmployeeBuilder{ id, name, password }));
-            break;
+            std::println(stderr, "Failed to open batch file {}", commands.string());
+            return false;
         }
 
-        std::println("{} is not a valid employee type, try again.", type);
+        text = mapping.contents();
     }
 
-    found = std::ranges::find_if(employees, idIs);
+    auto start{ std::chrono::steady_clock::now() };
+    BatchSummary summary;
 
-    if (found == employees.end())
     {
-        std::println("Error updating database!");
+        BulkWriter output{ STDOUT_FILENO };
+        summary = employees.write([&](EmployeeDatabase &master) { return ::runBatch(text, master, output); });
     }
 
-    clearScreen();
-    std::println("Employee title updated\n\n{}\n", **found);
-    clearScreenWhenReady();
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::println(stderr, "Ran {} commands in {:.3f} ms ({:.0f} commands/s), {} failed.",
+                 summary.commands, elapsed.count() * 1000.0,
+                 static_cast<double>(summary.commands) / elapsed.count(), summary.failed);
+
+    return summary.failed == 0;
 }
 
-void modifyExistingEmployee(std::vector<std::unique_ptr<Employee>> &employees)
+void ManagementInformationSystem::openDatabase()
 {
-    std::println("Which employee do you wish to modify?");
+    if (options.memoryBudget > 0)
+    {
+        return openBoundedDatabase();
+    }
 
-    unsigned id{ getExistingEmployeeId(employees) };
+    // Changes in the log only show once it is replayed into the loaded
+    // database, so sign in from the file alone only while it has none.
+    if (options.loadMode == LoadMode::lazy && !OperationLog::hasRecords(operationLogPath()))
+    {
+        fileIndex.emplace(options.database);
 
-    Field field{ selectFieldToModify() };
+        if (!fileIndex->isOpen())
+        {
+            fileIndex.reset();
+        }
+    }
 
-    switch (field)
+    auto load{ [this]
+        {
+            loadDatabase();
+            employees.publish();
+            loaded.count_down();
+        } };
+
+    if (fileIndex)
     {
-        case Field::id:
-            return modifyEmployeeId(employees, id);
-        case Field::name:
-            return modifyEmployeeName(employees, id);
-        case Field::password:
-            return modifyEmployeePassword(employees, id);
-        case Field::title:
-            return modifyEmployeeTitle(employees, id);
-        case Field::invalid: [[fallthrough]];
-        case Field::count:
-            std::unreachable();
+        loader = std::jthread{ load };
+    }
+    else
+    {
+        load();
     }
 }
 
-} // anonymous namespace
+void ManagementInformationSystem::openBoundedDatabase()
+{
+    OperationTimer timer{ Operation::load };
 
-void ManagementInformationSystem::login()
+    boundedEmployees.emplace(options.database, options.memoryBudget);
+    operationLog.emplace(operationLogPath(), options.database);
+
+    operationLog->replay([this](LogRecord const &record) { boundedEmployees->apply(record); });
+    boundedEmployees->attachLog(&*operationLog);
+}
+
+void ManagementInformationSystem::loadDatabase()
 {
-    employees = populateEmployeesFromFile("data/employees.csv");
+    OperationTimer timer{ Operation::load };
+    std::optional<EmployeeStore> snapshot;
 
-    clearScreen();
-    std::println("**************************************************************");
-    std::println("Employee Management");
-    std::println("**************************************************************");
-    std::println();
-    std::println("Please enter your credentials to login.");
+    if (!options.snapshot.empty())
+    {
+        snapshot = loadSnapshot(options.snapshot, options.database, database);
+    }
+
+    if (snapshot)
+    {
+        employees.master().assign(std::move(*snapshot));
+    }
+    else
+    {
+        EmployeeStore store{ loadFromCSV() };
+
+        // Missing or stale snapshots are rebuilt so the next start is fast.
+        if (!options.snapshot.empty() && store.liveCount() > 0)
+        {
+            writeSnapshot(store, options.snapshot, options.database);
+        }
+
+        employees.master().assign(std::move(store));
+    }
+
+    openOperationLog();
+}
+
+std::filesystem::path ManagementInformationSystem::operationLogPath() const
+{
+    if (!options.operationLog.empty())
+    {
+        return options.operationLog;
+    }
+
+    std::filesystem::path path{ options.database };
+    path += ".log";
 
-    loggedInUser = requestUserLogin(employees);
+    return path;
+}
+
+void ManagementInformationSystem::openOperationLog()
+{
+    operationLog.emplace(operationLogPath(), options.database);
+
+    // Changes made in earlier sessions are replayed before any new ones are
+    // recorded, so replaying does not log them a second time.
+    operationLog->replay([this](LogRecord const &record) { employees.master().apply(record); });
+    employees.master().attachLog(&*operationLog);
 
-    if (loggedInUser)
+    if (options.saveInterval.count() > 0)
     {
-        displayMenu();
+        saver.emplace(employees.master(), options.database, &*operationLog, options.saveInterval);
     }
 }
 
-void ManagementInformationSystem::displayMenu()
+EmployeeStore ManagementInformationSystem::loadFromCSV()
 {
-    loggedInUser->displayMenu();
+    switch (options.loadMode)
+    {
+        case LoadMode::stream:
+            return populateEmployeesFromFile(options.database);
+        case LoadMode::mapped:
+            return populateEmployeesFromMapping(options.database, database);
+        case LoadMode::parallel: [[fallthrough]];
+        case LoadMode::lazy:
+            return populateEmployeesInParallel(options.database, database);
+    }
+
+    std::unreachable();
+}
 
+template<typename Roster, typename User>
+void ManagementInformationSystem::displayMenu(Roster &roster, User user)
+{
     std::string line;
     unsigned selection{};
 
@@ -632,12 +1250,28 @@ void ManagementInformationSystem::displayMenu()
         modify,
         add,
         remove,
+        statistics,
+        browse,
+        reports,
         selectionCount,
     };
 
     while (true)
     {
-        std::getline(std::cin, line);
+        {
+            auto version{ roster.read() };
+            auto self{ version->find(user) };
+
+            if (!self)
+            {
+                consolePrintln("Your employee record has been removed.");
+                return;
+            }
+
+            self->displayMenu();
+        }
+
+        consoleReadLine(line);
 
 
         if (std::from_chars(line.data(), line.data() + line.size(), selection).ec == std::errc{})
@@ -648,22 +1282,31 @@ void ManagementInformationSystem::displayMenu()
                 switch (MenuSelection(selection))
                 {
                     case MenuSelection::exit:
-                        std::println("Disconnected...");
+                        consolePrintln("Disconnected...");
                         return;
                     case MenuSelection::view:
-                        viewEmployees();
+                        viewEmployees(roster, user);
                         break;
                     case MenuSelection::search:
-                        searchEmployees();
+                        searchEmployees(roster, user);
                         break;
                     case MenuSelection::modify:
-                        modifyEmployee();
+                        modifyEmployee(roster, user);
                         break;
                     case MenuSelection::add:
-                        addEmployee();
+                        addEmployee(roster, user);
                         break;
                     case MenuSelection::remove:
-                        removeEmployee();
+                        removeEmployee(roster, user);
+                        break;
+                    case MenuSelection::statistics:
+                        viewStatistics(roster, user);
+                        break;
+                    case MenuSelection::browse:
+                        browseEmployees(roster, user);
+                        break;
+                    case MenuSelection::reports:
+                        viewReports(roster, user);
                         break;
                     case MenuSelection::selectionCount:
                         std::unreachable();
@@ -672,70 +1315,154 @@ void ManagementInformationSystem::displayMenu()
         }
         else
     {
-            std::println("Invalid selection.  Expected an integer, got {}.", line);
+            consolePrintln("Invalid selection.  Expected an integer, got {}.", line);
+        }
+    }
+}
+
+template<typename Roster, typename User>
+bool ManagementInformationSystem::userCan(Roster &roster, User user, Capability capability) const
+{
+    auto version{ roster.read() };
+    auto self{ version->find(user) };
+
+    return self && hasCapability(self->getRole(), capability);
+}
+
+template<typename Roster, typename User>
+void ManagementInformationSystem::viewEmployees(Roster &roster, User user) const
+{
+    // The version is let go before waiting for the user, so an idle session
+    // never keeps an old one alive.
+    {
+        OperationTimer timer{ Operation::view };
+        auto version{ roster.read() };
+        auto self{ version->find(user) };
+
+        if (!self)
+        {
+            return;
+        }
+
+        if (!self->canViewEmployees())
+        {
+            consolePrintln("Your Employee Data:\n{}", *self);
+        }
+        // Sessions other than the standard console are buffered already.
+        else if (useBulkOutput(options.outputMode) && currentConsole().isStandardOutput())
+        {
+            printAllEmployeesInBulk(*version);
         }
+        else
+        {
+            consolePrintln("************ ALL EMPLOYEES ************");
+
+            version->forEach([](auto const &employee)
+                {
+                    consolePrintln("{}", employee);
+                });
 
-        loggedInUser->displayMenu();
+            consolePrintln("***************************************");
+        }
     }
+
+    clearScreenWhenReady();
 }
 
-void ManagementInformationSystem::viewEmployees() const
+template<typename Roster, typename User>
+void ManagementInformationSystem::searchEmployees(Roster &roster, User user) const
 {
-    if (!loggedInUser->canViewEmployees())
+    if (!userCan(roster, user, Capability::searchEmployees))
     {
-        std::println("Your Employee Data:\n{}", *loggedInUser);
-        clearScreenWhenReady();
-        return;
+        return nope();
+    }
+
+    searchEmployeesBy(roster);
+}
+
+template<typename Roster, typename User>
+void ManagementInformationSystem::modifyEmployee(Roster &roster, User user)
+{
+    if (!userCan(roster, user, Capability::modifyEmployee))
+    {
+        return nope();
     }
 
-    std::println("************ ALL EMPLOYEES ************");
+    modifyExistingEmployee(roster);
+}
 
-    for (auto const &employee : employees)
+template<typename Roster, typename User>
+void ManagementInformationSystem::addEmployee(Roster &roster, User user)
+{
+    if (!userCan(roster, user, Capability::addEmployee))
     {
-        std::println("{}", *employee);
+        return nope();
     }
 
-    std::println("***************************************");
-    clearScreenWhenReady();
+    addNewEmployee(roster);
 }
 
-void ManagementInformationSystem::searchEmployees() const
+template<typename Roster, typename User>
+void ManagementInformationSystem::removeEmployee(Roster &roster, User user)
 {
-    if (!loggedInUser->canSearchEmployees())
+    if (!userCan(roster, user, Capability::removeEmployee))
     {
         return nope();
     }
 
-    searchEmployeesBy(employees);
+    removeCurrentEmployee(roster);
 }
 
-void ManagementInformationSystem::modifyEmployee()
+template<typename Roster, typename User>
+void ManagementInformationSystem::browseEmployees(Roster &roster, User user) const
 {
-    if (!loggedInUser->canModifyEmployee())
+    if (!userCan(roster, user, Capability::browseEmployees))
     {
         return nope();
     }
 
-    modifyExistingEmployee(employees);
+    browseEmployeesBy(roster);
 }
 
-void ManagementInformationSystem::addEmployee()
+template<typename Roster, typename User>
+void ManagementInformationSystem::viewReports(Roster &roster, User user) const
 {
-    if (!loggedInUser->canAddEmployee())
+    if (!userCan(roster, user, Capability::viewReports))
     {
         return nope();
     }
 
-    addNewEmployee(employees);
+    reportEmployeesBy(roster);
 }
 
-void ManagementInformationSystem::removeEmployee()
+template<typename Roster, typename User>
+void ManagementInformationSystem::viewStatistics(Roster &roster, User user) const
 {
-    if (!loggedInUser->canRemoveEmployee())
+    if (!userCan(roster, user, Capability::viewStatistics))
     {
         return nope();
     }
 
-    removeCurrentEmployee(employees);
+    consolePrintln("{}\n", statistics());
+    clearScreenWhenReady();
 }
 
+std::string ManagementInformationSystem::statistics() const
+{
+    std::string text{ formatOperationStatistics() };
+
+    if (boundedEmployees)
+    {
+        BoundedEmployeeDatabase::CacheStatistics cache{ boundedEmployees->cacheStatistics() };
+        std::uint64_t lookups{ cache.hits + cache.misses };
+
+        std::format_to(std::back_inserter(text),
+                       "\n\nRecord cache: {} records in {} of {} KiB, {} hits, {} misses ({:.1f}% hit rate), "
+                       "{} evictions.\nFile index: {} KiB.  Changed records awaiting save: {}.",
+                       cache.records, cache.bytes / 1024, cache.budget / 1024, cache.hits, cache.misses,
+                       lookups ? 100.0 * static_cast<double>(cache.hits) / static_cast<double>(lookups) : 0.0,
+                       cache.evictions, cache.indexBytes / 1024, cache.changes);
+    }
+
+    return text;
+}
@@ -8,43 +8,176 @@
 #ifndef MANAGEMENT_INFORMATION_SYSTEM_HPP
 #define MANAGEMENT_INFORMATION_SYSTEM_HPP
 
+#include "backgroundSaver.hpp"
+#include "boundedEmployeeDatabase.hpp"
+#include "bulkWriter.hpp"
+#include "employeeDatabase.hpp"
+#include "employeeFileIndex.hpp"
+#include "employeeLoader.hpp"
+#include "employeeStore.hpp"
 #include "employees.hpp"
-
-#include <memory>
-#include <vector>
-
+#include "mappedFile.hpp"
+#include "operationLog.hpp"
+#include "roles.hpp"
+#include "sharedEmployeeDatabase.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <latch>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+
+// Startup configuration for the management system.
+struct SystemOptions
+{
+    std::filesystem::path database{ "data/employees.csv" };
+    LoadMode loadMode{ LoadMode::mapped };
+    OutputMode outputMode{ OutputMode::automatic };
+    std::filesystem::path snapshot;      // Empty disables snapshots.
+    std::filesystem::path operationLog;  // Empty uses the database path plus ".log".
+    std::chrono::seconds saveInterval{ BackgroundSaver::defaultInterval };  // Zero disables saving.
+    std::size_t memoryBudget{};          // Bytes of cached records, zero loads every record.
+};
 
 // Management class.
 class ManagementInformationSystem
 {
 public:
+    explicit ManagementInformationSystem(SystemOptions systemOptions = {})
+    : options{ std::move(systemOptions) }
+    {}
+
+    // Saves the bounded memory database, whose changes are otherwise only
+    // saved on exit.
+    ~ManagementInformationSystem();
+
     // Public function to log in to the management system.
     void login();
 
+    // Serves login sessions to any number of clients connecting to the Unix
+    // socket at `socket`, until interrupted.  Returns false if it could not
+    // listen.
+    bool serve(std::filesystem::path const &socket);
+
+    // Converts the CSV database into a binary snapshot, returns false on failure.
+    bool buildSnapshot();
+
+    // Runs the commands in the file at `commands`, or standard input for "-",
+    // without prompting, see batchMode.hpp.  Returns false if any failed.
+    bool runBatch(std::filesystem::path const &commands);
+
+    // Table of operation latencies, and of the record cache in bounded
+    // memory mode.
+    std::string statistics() const;
+
 private:
-    // Displays and selects menu actions.
-    void displayMenu();
+    // Loads and publishes the database for the sessions.  In lazy load mode
+    // the database file is only indexed by ID here, and loaded on another
+    // thread while users sign in, see EmployeeFileIndex.
+    void openDatabase();
+
+    // With a memory budget, indexes the database file and replays the log
+    // into a BoundedEmployeeDatabase instead of loading every record.
+    void openBoundedDatabase();
+
+    // Loads the snapshot if it is current, otherwise the CSV database.
+    void loadDatabase();
+
+    // Loads the CSV database using the configured load mode.
+    EmployeeStore loadFromCSV();
+
+    // Replays changes from earlier sessions, then records and periodically
+    // saves all further changes.
+    void openOperationLog();
+
+    std::filesystem::path operationLogPath() const;
+
+    // Logs a user in and runs their menus on the calling thread's console.
+    void runSession();
+
+    // Signs a user in against the database file while the database is still
+    // loading, then resolves them in the loaded database.
+    std::optional<EmployeeHandle> loginWhileLoading();
+
+    // Displays and selects menu actions.  The signed in user is identified
+    // in `roster`, either the shared database by a handle to their record or
+    // the bounded memory database by their ID, and is looked up again for
+    // every action, so changes made by other users, e.g. to their role, take
+    // effect immediately.
+    template<typename Roster, typename User>
+    void displayMenu(Roster &roster, User user);
+
+    // Whether the latest version of the user's record has `capability`.
+    template<typename Roster, typename User>
+    bool userCan(Roster &roster, User user, Capability capability) const;
 
     // Displays employees based on user permissions.
-    void viewEmployees() const;
+    template<typename Roster, typename User>
+    void viewEmployees(Roster &roster, User user) const;
 
     // Allows the user to search for employees if permissions are sufficient.
-    void searchEmployees() const;
+    template<typename Roster, typename User>
+    void searchEmployees(Roster &roster, User user) const;
 
     // Allows the user to modify an employee if permissions are sufficient.
-    void modifyEmployee();
+    template<typename Roster, typename User>
+    void modifyEmployee(Roster &roster, User user);
 
     // Allows the user to add an employee if permissions are sufficient.
-    void addEmployee();
+    template<typename Roster, typename User>
+    void addEmployee(Roster &roster, User user);
 
     // Allows the user to remove an employee if permissions are sufficient.
-    void removeEmployee();
+    template<typename Roster, typename User>
+    void removeEmployee(Roster &roster, User user);
+
+    // Pages through employees sorted by ID, name or title, or within a range
+    // of IDs, if permissions are sufficient.
+    template<typename Roster, typename User>
+    void browseEmployees(Roster &roster, User user) const;
+
+    // Shows the latency of every operation so far, to users permitted to.
+    template<typename Roster, typename User>
+    void viewStatistics(Roster &roster, User user) const;
+
+    // Shows the headcount of every title and pages through the employees
+    // with a chosen title, if permissions are sufficient.
+    template<typename Roster, typename User>
+    void viewReports(Roster &roster, User user) const;
+
+    // Configuration supplied at construction.
+    SystemOptions options;
+
+    // Memory mapped database or snapshot file, must be declared before (and
+    // so outlive) the employees that view it.
+    MappedFile database;
+
+    // Durable record of changes, must outlive the employees that write to it.
+    std::optional<OperationLog> operationLog;
+
+    // Employee objects and their indexes, the pseudo-database for the exercise,
+    // shared by every session.
+    SharedEmployeeDatabase employees;
+
+    // Bounded memory mode: used by sessions instead of `employees`, which
+    // stays empty.
+    std::optional<BoundedEmployeeDatabase> boundedEmployees;
+
+    // Writes changes back to the database, declared after (and so destroyed
+    // before) the employees and log it saves.
+    std::optional<BackgroundSaver> saver;
 
-    // Vector of Employee objects that serves as the pseudo-database for the exercise.
-    std::vector<std::unique_ptr<Employee>> employees;
+    // Lazy load mode: the database file indexed by ID, for signing in while
+    // the database loads on `loader`.  Reached zero once it is loaded.
+    std::optional<EmployeeFileIndex> fileIndex;
+    std::latch loaded{ 1 };
 
-    // The currently logged in user.
-    Employee *loggedInUser{ nullptr };
+    // Declared last, so it is joined before anything it loads into is destroyed.
+    std::jthread loader;
 
 };
 
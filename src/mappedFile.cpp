@@ -0,0 +1,97 @@
+//******************************************************************************
+//File Name: mappedFile.cpp
+//Description: Implementation for MappedFile object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "mappedFile.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <utility>
+
+
+MappedFile::MappedFile(std::filesystem::path const &path)
+{
+    int fd{ ::open(path.c_str(), O_RDONLY | O_CLOEXEC) };
+
+    if (fd < 0)
+    {
+        return;
+    }
+
+    struct stat info{};
+
+    if (::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return;
+    }
+
+    m_size = static_cast<std::size_t>(info.st_size);
+
+    // An empty file cannot be mapped, but is still a valid (empty) file.
+    if (m_size == 0)
+    {
+        ::close(fd);
+        m_isOpen = true;
+        return;
+    }
+
+    void *mapped{ ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0) };
+    ::close(fd);  // The mapping holds its own reference to the file.
+
+    if (mapped == MAP_FAILED)
+    {
+        m_size = 0;
+        return;
+    }
+
+    // The loader walks the file front to back exactly once, let the kernel
+    // read ahead aggressively so startup is bound by page fault throughput.
+    ::madvise(mapped, m_size, MADV_SEQUENTIAL);
+    ::madvise(mapped, m_size, MADV_WILLNEED);
+
+    m_data = static_cast<char const *>(mapped);
+    m_isOpen = true;
+}
+
+MappedFile::~MappedFile()
+{
+    release();
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+: m_data{ std::exchange(other.m_data, nullptr) }
+, m_size{ std::exchange(other.m_size, 0) }
+, m_isOpen{ std::exchange(other.m_isOpen, false) }
+{}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other)
+    {
+        release();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_isOpen = std::exchange(other.m_isOpen, false);
+    }
+
+    return *this;
+}
+
+void MappedFile::release()
+{
+    if (m_data)
+    {
+        ::munmap(const_cast<char *>(m_data), m_size);
+    }
+
+    m_data = nullptr;
+    m_size = 0;
+    m_isOpen = false;
+}
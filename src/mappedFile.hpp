@@ -0,0 +1,48 @@
+//******************************************************************************
+//File Name: mappedFile.hpp
+//Description: Read only memory mapping of a file.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+
+// Owns a read only, private mapping of an entire file.  The mapping is released
+// when the object is destroyed, so anything viewing `contents()` must not
+// outlive it.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+
+    // Maps the file at `path`, check `isOpen()` for success.
+    explicit MappedFile(std::filesystem::path const &path);
+
+    ~MappedFile();
+
+    // Mappings are unique, but may be moved.
+    MappedFile(MappedFile const &) = delete;
+    MappedFile &operator=(MappedFile const &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    bool isOpen() const { return m_isOpen; }
+
+    // Contents of the mapped file.
+    std::string_view contents() const { return { m_data, m_size }; }
+
+private:
+    void release();
+
+    char const *m_data{ nullptr };
+    std::size_t m_size{};
+    bool m_isOpen{ false };
+};
+
+#endif
@@ -0,0 +1,85 @@
+//******************************************************************************
+//File Name: nameIndex.cpp
+//Description: Implementation for NameIndex object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "nameIndex.hpp"
+
+#include <algorithm>
+
+
+void NameIndex::insert(std::string_view name, unsigned id)
+{
+    auto found{ m_postings.find(name) };
+
+    if (found == m_postings.end())
+    {
+        found = m_postings.emplace(name, std::vector<unsigned>{}).first;
+        m_sortedNames.insert(found->first);
+    }
+
+    found->second.push_back(id);
+}
+
+void NameIndex::erase(std::string_view name, unsigned id)
+{
+    auto found{ m_postings.find(name) };
+
+    if (found == m_postings.end())
+    {
+        return;
+    }
+
+    std::vector<unsigned> &ids{ found->second };
+    auto posting{ std::ranges::find(ids, id) };
+
+    if (posting != ids.end())
+    {
+        ids.erase(posting);
+    }
+
+    if (ids.empty())
+    {
+        // The sorted set views the key, so it must go first.
+        m_sortedNames.erase(found->first);
+        m_postings.erase(found);
+    }
+}
+
+void NameIndex::changeID(std::string_view name, unsigned id, unsigned newID)
+{
+    auto found{ m_postings.find(name) };
+
+    if (found != m_postings.end())
+    {
+        std::ranges::replace(found->second, id, newID);
+    }
+}
+
+std::span<unsigned const> NameIndex::find(std::string_view name) const
+{
+    auto found{ m_postings.find(name) };
+    return found == m_postings.end() ? std::span<unsigned const>{} : found->second;
+}
+
+std::size_t NameIndex::countWithPrefix(std::string_view prefix, std::size_t limit) const
+{
+    std::size_t count{};
+
+    for (auto name{ m_sortedNames.lower_bound(prefix) };
+         name != m_sortedNames.end() && name->starts_with(prefix) && count <= limit;
+         ++name)
+    {
+        count += find(*name).size();
+    }
+
+    return count;
+}
+
+void NameIndex::clear()
+{
+    m_sortedNames.clear();
+    m_postings.clear();
+}
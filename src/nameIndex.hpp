@@ -0,0 +1,72 @@
+//******************************************************************************
+//File Name: nameIndex.hpp
+//Description: Index from employee name to the IDs of employees with that name.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef NAME_INDEX_HPP
+#define NAME_INDEX_HPP
+
+#include <cstddef>
+#include <functional>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+// Maps each distinct name to a posting list of employee IDs, in the order they
+// were added.  Exact lookups are hashed, prefix lookups walk a sorted set of
+// the distinct names.
+class NameIndex
+{
+public:
+    void insert(std::string_view name, unsigned id);
+
+    // Removes `id` from the postings of `name`, and `name` once it has none.
+    void erase(std::string_view name, unsigned id);
+
+    // Replaces `id` with `newID` in the postings of `name`, keeping its place.
+    void changeID(std::string_view name, unsigned id, unsigned newID);
+
+    // IDs of the employees named exactly `name`.
+    std::span<unsigned const> find(std::string_view name) const;
+
+    // Calls `visit(name, ids)` for every distinct name starting with `prefix`,
+    // in lexicographical order of name.
+    template<typename Visit>
+    void forEachWithPrefix(std::string_view prefix, Visit &&visit) const
+    {
+        for (auto name{ m_sortedNames.lower_bound(prefix) };
+             name != m_sortedNames.end() && name->starts_with(prefix);
+             ++name)
+        {
+            visit(*name, find(*name));
+        }
+    }
+
+    // Number of IDs of the names starting with `prefix`, counting no further
+    // than past `limit`, so a broad prefix costs no more than a narrow one.
+    std::size_t countWithPrefix(std::string_view prefix, std::size_t limit) const;
+
+    void clear();
+
+private:
+    // Allows lookups by string_view without constructing a std::string.
+    struct NameHash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+    };
+
+    std::unordered_map<std::string, std::vector<unsigned>, NameHash, std::equal_to<>> m_postings;
+
+    // Views of the keys of `m_postings`, which are stable across rehashing.
+    std::set<std::string_view, std::less<>> m_sortedNames;
+};
+
+#endif
@@ -0,0 +1,469 @@
+//******************************************************************************
+//File Name: operationLog.cpp
+//Description: Implementation for OperationLog object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "operationLog.hpp"
+#include "mappedFile.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <print>
+#include <system_error>
+#include <utility>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+// The log starts with a header naming the database it applies to.
+struct LogHeader
+{
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint64_t databaseSize;
+    std::int64_t databaseModified;
+};
+
+constexpr std::array<char, 8> logMagic{ 'E', 'M', 'P', 'L', 'O', 'G', '\0', '\0' };
+constexpr std::uint32_t logVersion{ 1 };
+constexpr std::uint32_t byteOrderMark{ 0x01020304 };
+
+LogHeader headerFor(FileStamp database)
+{
+    return { logMagic, logVersion, byteOrderMark, database.size, database.modified };
+}
+
+// Stamp of the database the log at `path` applies to, or nullopt if it is
+// missing or not a log.
+std::optional<FileStamp> readStamp(std::filesystem::path const &path)
+{
+    std::ifstream file{ path, std::ios::binary };
+    LogHeader header;
+
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(header))
+        || header.magic != logMagic || header.version != logVersion || header.byteOrder != byteOrderMark)
+    {
+        return std::nullopt;
+    }
+
+    return FileStamp{ header.databaseSize, header.databaseModified };
+}
+
+// Each record is a frame header followed by a payload of the operation, both
+// IDs, the role, and the length prefixed name and password.
+struct FrameHeader
+{
+    std::uint32_t payloadSize;
+    std::uint32_t checksum;
+};
+
+constexpr std::size_t fixedPayloadSize{ 1 + 4 + 4 + 1 + 4 + 4 };
+
+std::uint32_t checksum(std::string_view bytes)
+{
+    std::uint32_t hash{ 2166136261u };
+
+    for (char c : bytes)
+    {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+
+    return hash;
+}
+
+template<typename T>
+void put(std::string &out, T value)
+{
+    out.append(reinterpret_cast<char const *>(&value), sizeof(value));
+}
+
+template<typename T>
+T take(std::string_view &in)
+{
+    T value;
+    std::memcpy(&value, in.data(), sizeof(value));
+    in.remove_prefix(sizeof(value));
+
+    return value;
+}
+
+void encode(LogRecord const &record, std::string &out)
+{
+    std::size_t const frameStart{ out.size() };
+    put(out, FrameHeader{});
+
+    put(out, record.operation);
+    put(out, std::uint32_t{ record.id });
+    put(out, std::uint32_t{ record.newID });
+    put(out, record.role);
+    put(out, static_cast<std::uint32_t>(record.name.size()));
+    out.append(record.name);
+    put(out, static_cast<std::uint32_t>(record.password.size()));
+    out.append(record.password);
+
+    std::string_view payload{ std::string_view{ out }.substr(frameStart + sizeof(FrameHeader)) };
+    FrameHeader header{ static_cast<std::uint32_t>(payload.size()), checksum(payload) };
+    std::memcpy(out.data() + frameStart, &header, sizeof(header));
+}
+
+// Decodes the payload of an intact frame, returns false if it is malformed.
+bool decode(std::string_view payload, LogRecord &record)
+{
+    if (payload.size() < fixedPayloadSize)
+    {
+        return false;
+    }
+
+    record.operation = take<LogOperation>(payload);
+    record.id = take<std::uint32_t>(payload);
+    record.newID = take<std::uint32_t>(payload);
+    record.role = take<Role>(payload);
+
+    std::uint32_t const nameSize{ take<std::uint32_t>(payload) };
+
+    if (payload.size() < nameSize + sizeof(std::uint32_t))
+    {
+        return false;
+    }
+
+    record.name = payload.substr(0, nameSize);
+    payload.remove_prefix(nameSize);
+
+    std::uint32_t const passwordSize{ take<std::uint32_t>(payload) };
+
+    if (payload.size() != passwordSize)
+    {
+        return false;
+    }
+
+    record.password = payload;
+
+    return record.operation >= LogOperation::add && record.operation <= LogOperation::changeRole
+        && static_cast<std::size_t>(record.role) < roleCount;
+}
+
+bool writeAll(int fd, std::string_view bytes)
+{
+    while (!bytes.empty())
+    {
+        ssize_t written{ ::write(fd, bytes.data(), bytes.size()) };
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return false;
+        }
+
+        bytes.remove_prefix(static_cast<std::size_t>(written));
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+OperationLog::OperationLog(std::filesystem::path path, std::filesystem::path const &database,
+                           std::chrono::milliseconds commitInterval)
+: m_path{ std::move(path) }
+, m_commitInterval{ commitInterval }
+{
+    FileStamp const current{ stampOf(database) };
+    std::filesystem::path next{ m_path };
+    next += ".next";
+
+    // A replacement left by an interrupted checkpoint is only current if the
+    // checkpoint got as far as publishing its database.
+    if (std::filesystem::exists(next))
+    {
+        std::error_code error;
+
+        if (readStamp(next) == current)
+        {
+            std::filesystem::rename(next, m_path, error);
+        }
+        else
+        {
+            std::filesystem::remove(next, error);
+        }
+    }
+
+    if (std::filesystem::exists(m_path) && std::filesystem::file_size(m_path) > 0
+        && readStamp(m_path) != current)
+    {
+        std::filesystem::path stale{ m_path };
+        stale += ".stale";
+
+        std::println("Operation log {} does not match {}, moving it to {}.",
+                     m_path.string(), database.string(), stale.string());
+
+        std::error_code error;
+        std::filesystem::rename(m_path, stale, error);
+    }
+
+    open(current);
+
+    if (!isOpen())
+    {
+        std::println("Failed to open operation log {}, changes will not be saved.", m_path.string());
+        return;
+    }
+
+    m_committer = std::jthread{ [this](std::stop_token stop) { runCommitter(stop); } };
+}
+
+OperationLog::~OperationLog()
+{
+    if (m_committer.joinable())
+    {
+        m_committer.request_stop();
+        m_committer.join();
+    }
+
+    if (isOpen())
+    {
+        commit();
+        ::close(m_fd);
+    }
+}
+
+void OperationLog::open(FileStamp database)
+{
+    m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+    if (m_fd < 0)
+    {
+        return;
+    }
+
+    off_t const size{ ::lseek(m_fd, 0, SEEK_END) };
+
+    if (size <= 0)
+    {
+        LogHeader const header{ headerFor(database) };
+
+        if (!writeAll(m_fd, { reinterpret_cast<char const *>(&header), sizeof(header) }) || ::fdatasync(m_fd) != 0)
+        {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+
+        m_loggedSize = 0;
+        return;
+    }
+
+    m_loggedSize = static_cast<std::uint64_t>(size) - sizeof(LogHeader);
+}
+
+bool OperationLog::hasRecords(std::filesystem::path const &path)
+{
+    std::error_code error;
+    std::uintmax_t size{ std::filesystem::file_size(path, error) };
+
+    return !error && size > sizeof(LogHeader);
+}
+
+std::size_t OperationLog::replay(std::function<void(LogRecord const &)> const &apply)
+{
+    MappedFile mapping{ m_path };
+    std::string_view contents{ mapping.contents() };
+    std::size_t replayed{};
+    std::size_t intact{};
+
+    contents.remove_prefix(std::min(contents.size(), sizeof(LogHeader)));
+
+    while (contents.size() - intact >= sizeof(FrameHeader))
+    {
+        FrameHeader header;
+        std::memcpy(&header, contents.data() + intact, sizeof(header));
+
+        std::string_view frame{ contents.substr(intact + sizeof(header)) };
+        LogRecord record{};
+
+        if (frame.size() < header.payloadSize
+            || checksum(frame.substr(0, header.payloadSize)) != header.checksum
+            || !decode(frame.substr(0, header.payloadSize), record))
+        {
+            break;
+        }
+
+        apply(record);
+        ++replayed;
+        intact += sizeof(header) + header.payloadSize;
+    }
+
+    if (intact != contents.size())
+    {
+        std::println("Discarding {} bytes of incomplete operation log {}.", contents.size() - intact, m_path.string());
+
+        if (isOpen() && ::ftruncate(m_fd, static_cast<off_t>(sizeof(LogHeader) + intact)) != 0)
+        {
+            std::println("Failed to truncate operation log {}.", m_path.string());
+        }
+
+        std::lock_guard lock{ m_mutex };
+        m_loggedSize = intact;
+    }
+
+    return replayed;
+}
+
+void OperationLog::append(LogRecord const &record)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    bool wasEmpty;
+
+    {
+        std::lock_guard lock{ m_mutex };
+        wasEmpty = m_pending.empty();
+        encode(record, m_pending);
+    }
+
+    // The committer only waits for the first record of a batch.
+    if (wasEmpty)
+    {
+        m_appended.notify_one();
+    }
+}
+
+void OperationLog::commit()
+{
+    std::lock_guard commitLock{ m_commitMutex };
+    commitPending();
+}
+
+void OperationLog::commitPending()
+{
+    std::string batch;
+
+    {
+        std::lock_guard lock{ m_mutex };
+        batch.swap(m_pending);
+        m_loggedSize += batch.size();
+    }
+
+    if (batch.empty())
+    {
+        return;
+    }
+
+    if (!writeAll(m_fd, batch) || ::fdatasync(m_fd) != 0)
+    {
+        std::println(stderr, "Failed to commit to operation log {}: {}", m_path.string(), std::strerror(errno));
+    }
+}
+
+std::uint64_t OperationLog::mark()
+{
+    std::lock_guard lock{ m_mutex };
+    return m_loggedSize + m_pending.size();
+}
+
+bool OperationLog::checkpoint(std::uint64_t position, FileStamp database, std::function<bool()> const &publish)
+{
+    if (!isOpen())
+    {
+        return publish();
+    }
+
+    // Commits wait for the checkpoint, appends keep collecting in m_pending.
+    std::lock_guard commitLock{ m_commitMutex };
+    commitPending();
+
+    std::uint64_t end;
+
+    {
+        std::lock_guard lock{ m_mutex };
+        end = m_loggedSize;
+    }
+
+    // Records after `position` are not in the new database, so carry them over.
+    std::string carried(end - position, '\0');
+
+    if (::pread(m_fd, carried.data(), carried.size(), static_cast<off_t>(sizeof(LogHeader) + position))
+        != static_cast<ssize_t>(carried.size()))
+    {
+        std::println(stderr, "Failed to read operation log {}: {}", m_path.string(), std::strerror(errno));
+        return false;
+    }
+
+    std::filesystem::path next{ m_path };
+    next += ".next";
+
+    int nextFd{ ::open(next.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644) };
+    LogHeader const header{ headerFor(database) };
+
+    bool written{ nextFd >= 0
+                  && writeAll(nextFd, { reinterpret_cast<char const *>(&header), sizeof(header) })
+                  && writeAll(nextFd, carried)
+                  && ::fdatasync(nextFd) == 0 };
+
+    if (nextFd >= 0)
+    {
+        ::close(nextFd);
+    }
+
+    std::error_code error;
+
+    if (!written || !publish())
+    {
+        std::filesystem::remove(next, error);
+        return false;
+    }
+
+    std::filesystem::rename(next, m_path, error);
+
+    if (error)
+    {
+        // Left in place, the replacement is picked up at the next start.
+        std::println(stderr, "Failed to replace operation log {}: {}", m_path.string(), error.message());
+        return true;
+    }
+
+    ::close(m_fd);
+    m_fd = ::open(m_path.c_str(), O_RDWR | O_APPEND | O_CLOEXEC);
+
+    std::lock_guard lock{ m_mutex };
+    m_loggedSize -= position;
+
+    return true;
+}
+
+void OperationLog::runCommitter(std::stop_token stop)
+{
+    while (!stop.stop_requested())
+    {
+        {
+            std::unique_lock lock{ m_mutex };
+
+            if (!m_appended.wait(lock, stop, [this] { return !m_pending.empty(); }))
+            {
+                return;  // Stopped, the destructor commits what remains.
+            }
+
+            // Let the rest of a burst of edits join this commit.
+            m_appended.wait_for(lock, stop, m_commitInterval, [] { return false; });
+        }
+
+        commit();
+    }
+}
@@ -0,0 +1,187 @@
+//******************************************************************************
+//File Name: operationLog.hpp
+//Description: Append only log of employee modifications with group commit.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef OPERATION_LOG_HPP
+#define OPERATION_LOG_HPP
+
+#include "employeeStore.hpp"
+#include "fileStamp.hpp"
+#include "roles.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+
+enum class LogOperation : std::uint8_t
+{
+    add = 1,
+    remove,
+    changeID,
+    rename,
+    changePassword,
+    changeRole,
+};
+
+// One modification of the database.  Only the fields used by `operation` are
+// meaningful, e.g. `newID` for changeID or `name` for add and rename.
+struct LogRecord
+{
+    LogOperation operation;
+    unsigned id;
+    unsigned newID{};
+    Role role{};
+    std::string_view name{};
+    std::string_view password{};
+};
+
+// Performs `record` on `employees`, which has the modifiers of
+// EmployeeDatabase, or returns false and changes nothing if it does not apply
+// to the current contents, e.g. adding an existing ID, or holds a name or
+// password that could not have been entered.
+template<typename Employees>
+bool applyLogRecord(Employees &employees, LogRecord const &record)
+{
+    switch (record.operation)
+    {
+        case LogOperation::add:
+            if (employees.contains(record.id) || !isValidField(record.name) || !isValidField(record.password))
+            {
+                return false;
+            }
+
+            employees.add({ .id = record.id, .name = record.name, .password = record.password, .role = record.role });
+            return true;
+        case LogOperation::remove:
+            if (!employees.contains(record.id))
+            {
+                return false;
+            }
+
+            employees.remove(record.id);
+            return true;
+        case LogOperation::changeID:
+            if (!employees.contains(record.id) || employees.contains(record.newID))
+            {
+                return false;
+            }
+
+            employees.changeID(record.id, record.newID);
+            return true;
+        case LogOperation::rename:
+            if (!employees.contains(record.id) || !isValidField(record.name))
+            {
+                return false;
+            }
+
+            employees.rename(record.id, record.name);
+            return true;
+        case LogOperation::changePassword:
+            if (!employees.contains(record.id) || !isValidField(record.password))
+            {
+                return false;
+            }
+
+            employees.changePassword(record.id, record.password);
+            return true;
+        case LogOperation::changeRole:
+            if (!employees.contains(record.id))
+            {
+                return false;
+            }
+
+            employees.changeRole(record.id, record.role);
+            return true;
+    }
+
+    return false;
+}
+
+// Durable, append only record of every modification since the database was
+// last loaded.  Appends are buffered and a committer thread writes and syncs
+// everything appended within one commit interval together, so a burst of edits
+// costs a single fsync and no edit waits on the disk.  At most one commit
+// interval of edits is lost if the process dies.
+//
+// Each record is framed by its length and checksum, so a record torn by a
+// crash is detected on replay and discarded along with anything after it.
+//
+// The log begins with the stamp of the database it applies to.  Checkpoints
+// write the records not yet in a new database to a replacement log stamped
+// with that database before it is published, so after a crash at any point
+// the log on disk either matches the database or can be completed to.
+class OperationLog
+{
+public:
+    static constexpr std::chrono::milliseconds defaultCommitInterval{ 10 };
+
+    // Opens or creates the log at `path` for the database at `database`,
+    // check `isOpen()` for success.  A log belonging to another version of
+    // the database is set aside rather than replayed.
+    OperationLog(std::filesystem::path path, std::filesystem::path const &database,
+                 std::chrono::milliseconds commitInterval = defaultCommitInterval);
+
+    // Commits anything still buffered.
+    ~OperationLog();
+
+    OperationLog(OperationLog const &) = delete;
+    OperationLog &operator=(OperationLog const &) = delete;
+
+    bool isOpen() const { return m_fd >= 0; }
+
+    // Whether the log at `path` holds any records, whether or not they apply
+    // to the current database, without opening it.
+    static bool hasRecords(std::filesystem::path const &path);
+
+    // Calls `apply(record)` for every intact record in the log, oldest first,
+    // and truncates any torn tail.  Returns the number of records replayed.
+    std::size_t replay(std::function<void(LogRecord const &)> const &apply);
+
+    // Buffers `record`, which is made durable by the next commit.
+    void append(LogRecord const &record);
+
+    // Writes and syncs everything appended so far before returning.
+    void commit();
+
+    // Position following every record appended so far.
+    std::uint64_t mark();
+
+    // Replaces the log with the records appended after `position`, stamped
+    // with `database`, once `publish()` has made that database current.  The
+    // replacement is written before `publish` is called and only put in place
+    // if it returns true.  Appends are not blocked meanwhile.
+    bool checkpoint(std::uint64_t position, FileStamp database, std::function<bool()> const &publish);
+
+private:
+    void runCommitter(std::stop_token stop);
+
+    // Writes and syncs the pending records, m_commitMutex must be held.
+    void commitPending();
+
+    // Opens the log, setting it up for `database` if it is new.
+    void open(FileStamp database);
+
+    std::filesystem::path m_path;
+    std::chrono::milliseconds m_commitInterval;
+    int m_fd{ -1 };
+    std::uint64_t m_loggedSize{};   // Bytes of records handed to the file.
+
+    std::mutex m_mutex;             // Guards m_pending and m_loggedSize.
+    std::mutex m_commitMutex;       // Keeps commits in append order.
+    std::condition_variable_any m_appended;
+    std::string m_pending;
+
+    std::jthread m_committer;       // Declared last, so started last.
+};
+
+#endif
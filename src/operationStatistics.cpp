@@ -0,0 +1,172 @@
+//******************************************************************************
+//File Name: operationStatistics.cpp
+//Description: Implementation for the operation counters and latency histograms.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "operationStatistics.hpp"
+#include "bulkWriter.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <iterator>
+
+
+#ifdef OPERATION_STATISTICS
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+// One histogram per operation, for the whole process.
+std::array<LatencyHistogram, static_cast<std::size_t>(Operation::count)> histograms;
+
+double microseconds(double nanoseconds)
+{
+    return nanoseconds / 1000.0;
+}
+
+double microseconds(std::uint64_t nanoseconds)
+{
+    return microseconds(static_cast<double>(nanoseconds));
+}
+
+} // anonymous namespace
+
+std::size_t LatencyHistogram::bucketOf(std::uint64_t nanoseconds)
+{
+    // Values below twice the sub-bucket count are exact, larger ones keep
+    // only their top subBucketBits + 1 bits.
+    unsigned shift{ nanoseconds < (std::uint64_t{ 2 } << subBucketBits)
+                    ? 0u : static_cast<unsigned>(std::bit_width(nanoseconds)) - subBucketBits - 1 };
+
+    return (std::size_t{ shift } << subBucketBits) + (nanoseconds >> shift);
+}
+
+std::uint64_t LatencyHistogram::bucketLimit(std::size_t bucket)
+{
+    std::size_t shift{ bucket < (std::size_t{ 2 } << subBucketBits) ? 0 : (bucket >> subBucketBits) - 1 };
+    std::uint64_t top{ bucket - (shift << subBucketBits) };
+
+    return ((top + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(std::uint64_t nanoseconds)
+{
+    m_buckets[bucketOf(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    m_total.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+    std::uint64_t max{ m_max.load(std::memory_order_relaxed) };
+
+    while (nanoseconds > max && !m_max.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+LatencyHistogram::Summary LatencyHistogram::summarize() const
+{
+    std::array<std::uint64_t, bucketCount> counts;
+    Summary summary{};
+
+    for (std::size_t bucket{}; bucket < bucketCount; ++bucket)
+    {
+        counts[bucket] = m_buckets[bucket].load(std::memory_order_relaxed);
+        summary.count += counts[bucket];
+    }
+
+    if (summary.count == 0)
+    {
+        return summary;
+    }
+
+    summary.max = m_max.load(std::memory_order_relaxed);
+    summary.mean = static_cast<double>(m_total.load(std::memory_order_relaxed)) / static_cast<double>(summary.count);
+
+    // Each percentile is the highest latency of the bucket its rank falls in.
+    auto percentile{ [&](std::uint64_t perMille)
+        {
+            std::uint64_t rank{ std::max<std::uint64_t>((summary.count * perMille + 999) / 1000, 1) };
+            std::uint64_t seen{};
+
+            for (std::size_t bucket{}; bucket < bucketCount; ++bucket)
+            {
+                seen += counts[bucket];
+
+                if (seen >= rank)
+                {
+                    return std::min(bucketLimit(bucket), summary.max);
+                }
+            }
+
+            return summary.max;
+        } };
+
+    summary.p50 = percentile(500);
+    summary.p90 = percentile(900);
+    summary.p99 = percentile(990);
+    summary.p999 = percentile(999);
+
+    return summary;
+}
+
+OperationTimer::~OperationTimer()
+{
+    auto elapsed{ std::chrono::steady_clock::now() - m_start };
+
+    histograms[static_cast<std::size_t>(m_operation)].record(
+        static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+}
+
+std::string formatOperationStatistics()
+{
+    std::string text{ std::format("{:<10} {:>10} {:>12} {:>12} {:>12} {:>12} {:>12} {:>12}", "operation", "count",
+                                  "mean us", "p50 us", "p90 us", "p99 us", "p99.9 us", "max us") };
+
+    for (std::size_t operation{}; operation < histograms.size(); ++operation)
+    {
+        LatencyHistogram::Summary summary{ histograms[operation].summarize() };
+
+        std::format_to(std::back_inserter(text),
+                       "\n{:<10} {:>10} {:>12.1f} {:>12.1f} {:>12.1f} {:>12.1f} {:>12.1f} {:>12.1f}",
+                       operationNames[operation], summary.count, microseconds(summary.mean),
+                       microseconds(summary.p50), microseconds(summary.p90), microseconds(summary.p99),
+                       microseconds(summary.p999), microseconds(summary.max));
+    }
+
+    return text;
+}
+
+#else
+
+std::string formatOperationStatistics()
+{
+    return "Operation statistics were compiled out of this build, see OPERATION_STATISTICS in CMakeLists.txt.";
+}
+
+#endif
+
+bool writeStatistics(std::filesystem::path const &path, std::string_view statistics)
+{
+    int fd{ ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644) };
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    bool written{};
+
+    {
+        BulkWriter writer{ fd };
+        writer.println("{}", statistics);
+        writer.flush();
+        written = !writer.failed();
+    }
+
+    return ::close(fd) == 0 && written;
+}
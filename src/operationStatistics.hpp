@@ -0,0 +1,122 @@
+//******************************************************************************
+//File Name: operationStatistics.hpp
+//Description: Per operation counters and latency histograms.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef OPERATION_STATISTICS_HPP
+#define OPERATION_STATISTICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+
+// Operations timed by the management system.
+enum struct Operation : std::uint8_t
+{
+    load,       // Loading the database, including replaying its log.
+    login,      // Checking credentials.
+    view,       // Listing employees, or the user's own record.
+    search,     // Any search, including printing the matches.
+    add,        // Committing a new employee.
+    modify,     // Committing a change to an employee.
+    remove,     // Committing a removal.
+    count,
+};
+
+inline constexpr std::array<std::string_view, static_cast<std::size_t>(Operation::count)> operationNames{
+    "load", "login", "view", "search", "add", "modify", "remove",
+};
+
+#ifdef OPERATION_STATISTICS
+
+inline constexpr bool operationStatisticsEnabled{ true };
+
+// Counts of latencies in buckets of roughly equal relative width, as in an
+// HDR histogram: exact below 64 ns, then 32 buckets per doubling, so any
+// value is reported within about 3%.  Recording is a few relaxed atomic
+// increments, safe from any number of threads.
+class LatencyHistogram
+{
+public:
+    struct Summary
+    {
+        std::uint64_t count;
+        double mean;                // All latencies in nanoseconds.
+        std::uint64_t p50;
+        std::uint64_t p90;
+        std::uint64_t p99;
+        std::uint64_t p999;
+        std::uint64_t max;
+    };
+
+    void record(std::uint64_t nanoseconds);
+
+    // A consistent enough view while other threads keep recording.
+    Summary summarize() const;
+
+private:
+    static constexpr unsigned subBucketBits{ 5 };
+    static constexpr std::size_t bucketCount{ (65 - subBucketBits) << subBucketBits };
+
+    static std::size_t bucketOf(std::uint64_t nanoseconds);
+
+    // Highest latency counted in `bucket`.
+    static std::uint64_t bucketLimit(std::size_t bucket);
+
+    std::array<std::atomic<std::uint64_t>, bucketCount> m_buckets{};
+    std::atomic<std::uint64_t> m_total{};
+    std::atomic<std::uint64_t> m_max{};
+};
+
+// Records the time from construction to destruction as one `operation`.
+class OperationTimer
+{
+public:
+    explicit OperationTimer(Operation operation)
+    : m_operation{ operation }
+    , m_start{ std::chrono::steady_clock::now() }
+    {}
+
+    ~OperationTimer();
+
+    OperationTimer(OperationTimer const &) = delete;
+    OperationTimer &operator=(OperationTimer const &) = delete;
+
+private:
+    Operation m_operation;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#else
+
+inline constexpr bool operationStatisticsEnabled{ false };
+
+// Compiled out, timing nothing.
+class OperationTimer
+{
+public:
+    explicit OperationTimer(Operation) {}
+    ~OperationTimer() {}
+
+    OperationTimer(OperationTimer const &) = delete;
+    OperationTimer &operator=(OperationTimer const &) = delete;
+};
+
+#endif
+
+// Table of every operation's count and latency percentiles so far.
+std::string formatOperationStatistics();
+
+// Writes `statistics`, e.g. from formatOperationStatistics(), to `path`,
+// returns false on failure.
+bool writeStatistics(std::filesystem::path const &path, std::string_view statistics);
+
+#endif
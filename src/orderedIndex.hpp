@@ -0,0 +1,250 @@
+//******************************************************************************
+//File Name: orderedIndex.hpp
+//Description: Sorted keys addressable by rank, for paging through an ordering.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef ORDERED_INDEX_HPP
+#define ORDERED_INDEX_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+
+// Sorted set of keys that can also be addressed by rank, so the k keys from
+// any position of the ordering are found in O(log n + k).  Keys are kept in
+// sorted chunks of at most chunkCapacity, and a Fenwick tree of the chunk
+// sizes finds the chunk holding a rank.  An insertion or removal moves at
+// most one chunk's worth of keys, except when a chunk splits or merges, which
+// takes at least chunkCapacity / 4 modifications of it, and the list of chunks
+// and the tree are rebuilt in O(n / chunkCapacity).
+template<typename Key, typename Less = std::less<>>
+class OrderedIndex
+{
+public:
+    // Replaces the contents with `keys`, which must be sorted and distinct.
+    void assign(std::vector<Key> const &keys)
+    {
+        m_chunks.clear();
+
+        for (std::size_t first{}; first < keys.size(); first += chunkCapacity / 2)
+        {
+            auto begin{ keys.begin() + static_cast<std::ptrdiff_t>(first) };
+            auto end{ keys.begin() + static_cast<std::ptrdiff_t>(std::min(first + chunkCapacity / 2, keys.size())) };
+
+            m_chunks.emplace_back(begin, end);
+        }
+
+        m_size = keys.size();
+        rebuildTree();
+    }
+
+    // Adds `key`, which must not be present.
+    void insert(Key const &key)
+    {
+        if (m_chunks.empty())
+        {
+            m_chunks.push_back({ key });
+            m_size = 1;
+            rebuildTree();
+            return;
+        }
+
+        std::size_t chunk{ std::min(chunkOf(key), m_chunks.size() - 1) };
+        std::vector<Key> &keys{ m_chunks[chunk] };
+
+        keys.insert(std::ranges::upper_bound(keys, key, Less{}), key);
+        ++m_size;
+
+        if (keys.size() <= chunkCapacity)
+        {
+            grow(chunk);
+            return;
+        }
+
+        std::vector<Key> upper(keys.begin() + static_cast<std::ptrdiff_t>(keys.size() / 2), keys.end());
+        keys.resize(keys.size() / 2);
+        m_chunks.insert(m_chunks.begin() + static_cast<std::ptrdiff_t>(chunk + 1), std::move(upper));
+        rebuildTree();
+    }
+
+    // Removes `key` if present.
+    void erase(Key const &key)
+    {
+        std::size_t chunk{ chunkOf(key) };
+
+        if (chunk == m_chunks.size())
+        {
+            return;
+        }
+
+        std::vector<Key> &keys{ m_chunks[chunk] };
+        auto found{ std::ranges::lower_bound(keys, key, Less{}) };
+
+        if (found == keys.end() || Less{}(key, *found))
+        {
+            return;
+        }
+
+        keys.erase(found);
+        --m_size;
+
+        // Small chunks are merged into the next, so there are never many
+        // more chunks than n / (chunkCapacity / 4).
+        if (keys.empty())
+        {
+            m_chunks.erase(m_chunks.begin() + static_cast<std::ptrdiff_t>(chunk));
+            rebuildTree();
+        }
+        else if (keys.size() < chunkCapacity / 4 && chunk + 1 < m_chunks.size()
+                 && keys.size() + m_chunks[chunk + 1].size() <= chunkCapacity / 2)
+        {
+            std::vector<Key> &next{ m_chunks[chunk + 1] };
+
+            keys.insert(keys.end(), next.begin(), next.end());
+            m_chunks.erase(m_chunks.begin() + static_cast<std::ptrdiff_t>(chunk + 1));
+            rebuildTree();
+        }
+        else
+        {
+            shrink(chunk);
+        }
+    }
+
+    // Number of keys ordered before `key`.
+    std::size_t rank(Key const &key) const
+    {
+        std::size_t chunk{ chunkOf(key) };
+
+        if (chunk == m_chunks.size())
+        {
+            return m_size;
+        }
+
+        std::vector<Key> const &keys{ m_chunks[chunk] };
+        auto within{ std::ranges::lower_bound(keys, key, Less{}) - keys.begin() };
+
+        return keysBefore(chunk) + static_cast<std::size_t>(within);
+    }
+
+    // Calls `visit(key)` for at most `limit` keys in order, starting with the
+    // key of rank `first`.
+    template<typename Visit>
+    void forEach(std::size_t first, std::size_t limit, Visit &&visit) const
+    {
+        if (first >= m_size)
+        {
+            return;
+        }
+
+        auto [chunk, within]{ locate(first) };
+
+        for (; chunk < m_chunks.size() && limit > 0; ++chunk, within = 0)
+        {
+            std::vector<Key> const &keys{ m_chunks[chunk] };
+
+            for (; within < keys.size() && limit > 0; ++within, --limit)
+            {
+                visit(keys[within]);
+            }
+        }
+    }
+
+    std::size_t size() const { return m_size; }
+
+    void clear()
+    {
+        m_chunks.clear();
+        m_tree.clear();
+        m_size = 0;
+    }
+
+private:
+    static constexpr std::size_t chunkCapacity{ 512 };
+
+    static std::size_t lowestBit(std::size_t index) { return index & (~index + 1); }
+
+    // First chunk whose last key is not ordered before `key`, or the number
+    // of chunks if there is none.
+    std::size_t chunkOf(Key const &key) const
+    {
+        auto chunk{ std::ranges::partition_point(m_chunks, [&key](std::vector<Key> const &keys)
+            { return Less{}(keys.back(), key); }) };
+
+        return static_cast<std::size_t>(chunk - m_chunks.begin());
+    }
+
+    // Total size of the chunks before `chunk`.
+    std::size_t keysBefore(std::size_t chunk) const
+    {
+        std::size_t count{};
+
+        for (std::size_t index{ chunk }; index > 0; index -= lowestBit(index))
+        {
+            count += m_tree[index];
+        }
+
+        return count;
+    }
+
+    // Chunk holding the key of rank `rank`, which must be below size(), and
+    // the key's position within it.
+    std::pair<std::size_t, std::size_t> locate(std::size_t rank) const
+    {
+        std::size_t chunk{};
+
+        for (std::size_t step{ std::bit_floor(m_chunks.size()) }; step > 0; step /= 2)
+        {
+            if (chunk + step <= m_chunks.size() && m_tree[chunk + step] <= rank)
+            {
+                chunk += step;
+                rank -= m_tree[chunk];
+            }
+        }
+
+        return { chunk, rank };
+    }
+
+    void grow(std::size_t chunk)
+    {
+        for (std::size_t index{ chunk + 1 }; index < m_tree.size(); index += lowestBit(index))
+        {
+            ++m_tree[index];
+        }
+    }
+
+    void shrink(std::size_t chunk)
+    {
+        for (std::size_t index{ chunk + 1 }; index < m_tree.size(); index += lowestBit(index))
+        {
+            --m_tree[index];
+        }
+    }
+
+    // Builds the Fenwick tree, indexed from one, from the chunk sizes in O(chunks).
+    void rebuildTree()
+    {
+        m_tree.assign(m_chunks.size() + 1, 0);
+
+        for (std::size_t index{ 1 }; index < m_tree.size(); ++index)
+        {
+            m_tree[index] += m_chunks[index - 1].size();
+
+            if (std::size_t parent{ index + lowestBit(index) }; parent < m_tree.size())
+            {
+                m_tree[parent] += m_tree[index];
+            }
+        }
+    }
+
+    std::vector<std::vector<Key>> m_chunks;
+    std::vector<std::size_t> m_tree;
+    std::size_t m_size{};
+};
+
+#endif
@@ -0,0 +1,217 @@
+//******************************************************************************
+//File Name: roles.hpp
+//Description: Compile time registry of employee roles and their capabilities.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef ROLES_HPP
+#define ROLES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+
+// Actions an employee may be permitted to perform, one bit each.
+enum struct Capability : std::uint8_t
+{
+    viewEmployees   = 1 << 0,
+    searchEmployees = 1 << 1,
+    modifyEmployee  = 1 << 2,
+    addEmployee     = 1 << 3,
+    removeEmployee  = 1 << 4,
+    viewStatistics  = 1 << 5,
+    browseEmployees = 1 << 6,
+    viewReports     = 1 << 7,
+};
+
+constexpr std::uint8_t operator|(Capability lhs, Capability rhs)
+{
+    return static_cast<std::uint8_t>(static_cast<std::uint8_t>(lhs) | static_cast<std::uint8_t>(rhs));
+}
+
+constexpr std::uint8_t operator|(std::uint8_t lhs, Capability rhs)
+{
+    return static_cast<std::uint8_t>(lhs | static_cast<std::uint8_t>(rhs));
+}
+
+// Everything that distinguishes one role from another.
+struct RoleInfo
+{
+    std::string_view name;          // As written in the database, e.g. "ManagerEmployee".
+    std::string_view title;         // As displayed, e.g. "Manager Employee".
+    std::uint8_t capabilities;      // Bitwise or of Capability values.
+};
+
+// The role registry.  Adding a role is a matter of adding an entry here, the
+// parser, permission checks and menu are all derived from this table.
+inline constexpr std::array roleTable{
+    RoleInfo{ "GeneralEmployee", "General Employee", 0 },
+    RoleInfo{ "HumanResourcesEmployee", "Human Resources Employee",
+              Capability::viewEmployees | Capability::searchEmployees | Capability::modifyEmployee
+              | Capability::addEmployee | Capability::removeEmployee | Capability::viewStatistics
+              | Capability::browseEmployees | Capability::viewReports },
+    RoleInfo{ "ManagerEmployee", "Manager Employee",
+              Capability::viewEmployees | Capability::searchEmployees | Capability::viewReports },
+};
+
+inline constexpr std::size_t roleCount{ roleTable.size() };
+
+// A role is its index in the role table, stored as a one byte tag per record.
+enum struct Role : std::uint8_t {};
+
+constexpr RoleInfo const &roleInfo(Role role)
+{
+    return roleTable[static_cast<std::size_t>(role)];
+}
+
+// Permission checks are a single bit test.
+constexpr bool hasCapability(Role role, Capability capability)
+{
+    return (roleInfo(role).capabilities & static_cast<std::uint8_t>(capability)) != 0;
+}
+
+// Implementation details of the role registry.
+namespace rolesDetail
+{
+
+// FNV-1a, seeded so a collision free seed can be searched for at compile time.
+constexpr std::uint32_t hash(std::string_view text, std::uint32_t seed)
+{
+    std::uint32_t value{ 2166136261u ^ seed };
+
+    for (char c : text)
+    {
+        value = (value ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+
+    return value;
+}
+
+// Smallest power of two with room for every role.
+constexpr std::size_t slotCount{ [] {
+    std::size_t count{ 1 };
+
+    while (count < roleCount * 2)
+    {
+        count *= 2;
+    }
+
+    return count;
+}() };
+
+// Maps each hash slot to a role index, or roleCount for an empty slot.
+struct PerfectHash
+{
+    std::uint32_t seed;
+    std::array<std::uint8_t, slotCount> slots;
+};
+
+constexpr PerfectHash perfectHash{ [] {
+    for (std::uint32_t seed{}; seed < 100'000; ++seed)
+    {
+        PerfectHash candidate{ seed, {} };
+        candidate.slots.fill(static_cast<std::uint8_t>(roleCount));
+
+        bool collision{ false };
+
+        for (std::size_t role{}; role < roleCount && !collision; ++role)
+        {
+            auto &slot{ candidate.slots[hash(roleTable[role].name, seed) & (slotCount - 1)] };
+            collision = slot != roleCount;
+            slot = static_cast<std::uint8_t>(role);
+        }
+
+        if (!collision)
+        {
+            return candidate;
+        }
+    }
+
+    throw "No perfect hash seed found for the role table.";
+}() };
+
+// Menu text for a role, built at compile time from its capabilities.  Menu
+// entries are numbered by position so selections are the same for all roles.
+struct MenuText
+{
+    std::array<char, 512> text{};
+    std::size_t length{};
+
+    constexpr void append(std::string_view line)
+    {
+        for (char c : line)
+        {
+            text[length++] = c;
+        }
+    }
+
+    constexpr std::string_view view() const { return { text.data(), length }; }
+};
+
+constexpr std::array<MenuText, roleCount> menus{ [] {
+    std::array<MenuText, roleCount> built{};
+
+    for (std::size_t role{}; role < roleCount; ++role)
+    {
+        auto can{ [role](Capability capability)
+            { return (roleTable[role].capabilities & static_cast<std::uint8_t>(capability)) != 0; } };
+
+        MenuText &menu{ built[role] };
+        menu.append("0. Exit\n");
+        menu.append(can(Capability::viewEmployees) ? "1. View employees.\n" : "1. View employee file.\n");
+
+        if (can(Capability::searchEmployees))   { menu.append("2. Search for an employee.\n"); }
+        if (can(Capability::modifyEmployee))    { menu.append("3. Modify an employee.\n"); }
+        if (can(Capability::addEmployee))       { menu.append("4. Add an employee.\n"); }
+        if (can(Capability::removeEmployee))    { menu.append("5. Remove an employee.\n"); }
+#ifdef OPERATION_STATISTICS
+        if (can(Capability::viewStatistics))    { menu.append("6. View statistics.\n"); }
+#endif
+        if (can(Capability::browseEmployees))   { menu.append("7. Browse employees in order.\n"); }
+        if (can(Capability::viewReports))       { menu.append("8. View headcount by title.\n"); }
+    }
+
+    return built;
+}() };
+
+} // namespace rolesDetail
+
+// Parses a role as written in the database: one hash, one table load and one
+// string comparison.
+constexpr std::optional<Role> parseRole(std::string_view name)
+{
+    using namespace rolesDetail;
+
+    std::uint8_t index{ perfectHash.slots[hash(name, perfectHash.seed) & (slotCount - 1)] };
+
+    if (index == roleCount || roleTable[index].name != name)
+    {
+        return std::nullopt;
+    }
+
+    return Role{ index };
+}
+
+// Menu options available to a role, one per line.
+constexpr std::string_view roleMenu(Role role)
+{
+    return rolesDetail::menus[static_cast<std::size_t>(role)].view();
+}
+
+static_assert([] {
+    for (std::size_t role{}; role < roleCount; ++role)
+    {
+        if (parseRole(roleTable[role].name) != Role{ static_cast<std::uint8_t>(role) })
+        {
+            return false;
+        }
+    }
+
+    return !parseRole("Employee");
+}(), "Every role must parse back to itself.");
+
+#endif
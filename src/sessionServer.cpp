@@ -0,0 +1,559 @@
+//******************************************************************************
+//File Name: sessionServer.cpp
+//Description: Implementation for SessionServer object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "sessionServer.hpp"
+#include "console.hpp"
+
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+// Set from the signal handler, which then wakes the event loop.
+std::atomic<bool> stopRequested{ false };
+std::atomic<int> stopWakeFd{ -1 };
+
+void requestStop(int)
+{
+    stopRequested = true;
+
+    std::uint64_t const one{ 1 };
+    [[maybe_unused]] ssize_t ignored{ ::write(stopWakeFd, &one, sizeof(one)) };
+}
+
+void wake(int fd)
+{
+    std::uint64_t const one{ 1 };
+    [[maybe_unused]] ssize_t ignored{ ::write(fd, &one, sizeof(one)) };
+}
+
+// Console of one connection.  The session thread reads and writes it while
+// the event loop delivers input to it and collects its output.
+class SessionConsole : public Console
+{
+public:
+    // Output is handed to the event loop whenever the session waits for
+    // input, or sooner once this much has built up.
+    static constexpr std::size_t flushThreshold{ std::size_t{ 1 } << 16 };
+
+    // Longest line accepted, and most input held for the session to read,
+    // so no client can make the server buffer without bound.  Both are well
+    // beyond anything typed at the menus.
+    static constexpr std::size_t maxLineLength{ 4096 };
+    static constexpr std::size_t maxPendingInput{ std::size_t{ 1 } << 20 };
+
+    // Most output held for a client that is not reading it.  The session
+    // waits for the socket to drain below this before it writes more.
+    static constexpr std::size_t maxPendingOutput{ std::size_t{ 1 } << 20 };
+
+    explicit SessionConsole(int wakeFd)
+    : m_wakeFd{ wakeFd }
+    {}
+
+    // Session thread side.
+
+    bool readLine(std::string &line) override
+    {
+        wake(m_wakeFd);  // Let the prompt out before waiting for the answer.
+
+        std::unique_lock lock{ m_mutex };
+        m_input.wait(lock, [this] { return !m_lines.empty() || m_closed; });
+
+        if (m_lines.empty())
+        {
+            return false;
+        }
+
+        line = std::move(m_lines.front());
+        m_lines.pop_front();
+        m_pendingInput -= line.size();
+
+        return true;
+    }
+
+    void write(std::string_view text) override
+    {
+        std::unique_lock lock{ m_mutex };
+        m_output.append(text);
+
+        if (m_output.size() < flushThreshold)
+        {
+            return;
+        }
+
+        lock.unlock();
+        wake(m_wakeFd);
+        lock.lock();
+
+        // A closed console is never drained again, so it must not be waited on.
+        m_drained.wait(lock, [this] { return m_output.size() + m_unsent <= maxPendingOutput || m_closed; });
+    }
+
+    void clear() override
+    {
+        write("\x1b[H\x1b[2J\x1b[3J");
+    }
+
+    // Called once the session is over.
+    void finish()
+    {
+        {
+            std::lock_guard lock{ m_mutex };
+            m_finished = true;
+        }
+
+        wake(m_wakeFd);
+    }
+
+    // Event loop side.
+
+    // Adds received bytes, making each completed line available to the
+    // session.  Returns false, discarding all pending input and closing the
+    // console, if a line or the pending input grows past its limit.
+    bool deliver(std::string_view bytes)
+    {
+        bool accepted{ true };
+
+        {
+            std::lock_guard lock{ m_mutex };
+
+            for (char c : bytes)
+            {
+                if (c == '\n')
+                {
+                    if (m_partial.ends_with('\r'))
+                    {
+                        m_partial.pop_back();
+                    }
+
+                    m_pendingInput += m_partial.size();
+                    m_lines.push_back(std::move(m_partial));
+                    m_partial.clear();
+                }
+                else
+                {
+                    m_partial.push_back(c);
+                }
+
+                if (m_partial.size() > maxLineLength || m_pendingInput + m_partial.size() > maxPendingInput)
+                {
+                    m_lines.clear();
+                    m_partial.clear();
+                    m_pendingInput = 0;
+                    m_closed = true;
+                    accepted = false;
+                    break;
+                }
+            }
+        }
+
+        m_input.notify_one();
+
+        if (!accepted)
+        {
+            m_drained.notify_one();
+        }
+
+        return accepted;
+    }
+
+    // No more input will arrive, the session ends at its next prompt.
+    void close()
+    {
+        {
+            std::lock_guard lock{ m_mutex };
+            m_closed = true;
+        }
+
+        m_input.notify_one();
+        m_drained.notify_one();
+    }
+
+    // Hands the output over to be sent, counting it as unsent until
+    // `drained` reports otherwise.
+    std::string takeOutput()
+    {
+        std::lock_guard lock{ m_mutex };
+        m_unsent += m_output.size();
+        return std::exchange(m_output, {});
+    }
+
+    // Reports how much of the output taken is still unsent, letting a
+    // session held back by `maxPendingOutput` write again.
+    void drained(std::size_t unsent)
+    {
+        {
+            std::lock_guard lock{ m_mutex };
+            m_unsent = unsent;
+        }
+
+        m_drained.notify_one();
+    }
+
+    bool finished()
+    {
+        std::lock_guard lock{ m_mutex };
+        return m_finished;
+    }
+
+private:
+    int m_wakeFd;
+
+    std::mutex m_mutex;
+    std::condition_variable m_input;
+    std::deque<std::string> m_lines;
+    std::string m_partial;
+    std::size_t m_pendingInput{};   // Bytes in m_lines.
+    std::string m_output;
+    std::condition_variable m_drained;
+    std::size_t m_unsent{};         // Bytes taken by the event loop but not yet sent.
+    bool m_closed{ false };
+    bool m_finished{ false };
+};
+
+} // anonymous namespace
+
+struct SessionServer::Connection
+{
+    Connection(int socketFd, int wakeFd)
+    : fd{ socketFd }
+    , console{ wakeFd }
+    {}
+
+    int fd;
+    SessionConsole console;
+    std::string unsent;             // Output the socket has not yet accepted.
+    bool receiving{ true };
+    bool watched{ true };           // Registered with epoll.
+    std::jthread thread;            // Declared last, so started last.
+};
+
+SessionServer::SessionServer(std::filesystem::path socket, std::function<void()> session)
+: m_socket{ std::move(socket) }
+, m_session{ std::move(session) }
+{}
+
+SessionServer::~SessionServer()
+{
+    closeAll();
+
+    for (int fd : { m_listenFd, m_epollFd, m_wakeFd })
+    {
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
+    }
+
+    if (m_listenFd >= 0)
+    {
+        std::error_code error;
+        std::filesystem::remove(m_socket, error);
+    }
+}
+
+bool SessionServer::run()
+{
+    if (!listen())
+    {
+        return false;
+    }
+
+    std::println("Serving sessions on {}", m_socket.string());
+
+    stopWakeFd = m_wakeFd;
+
+    struct sigaction action{};
+    action.sa_handler = requestStop;
+    ::sigaction(SIGINT, &action, nullptr);
+    ::sigaction(SIGTERM, &action, nullptr);
+
+    std::array<epoll_event, 64> events;
+
+    while (!stopRequested)
+    {
+        int ready{ ::epoll_wait(m_epollFd, events.data(), static_cast<int>(events.size()), -1) };
+
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            std::println(stderr, "Session server stopped: {}", std::strerror(errno));
+            break;
+        }
+
+        for (epoll_event const &event : std::span{ events.data(), static_cast<std::size_t>(ready) })
+        {
+            if (event.data.fd == m_listenFd)
+            {
+                accept();
+            }
+            else if (event.data.fd == m_wakeFd)
+            {
+                std::uint64_t count;
+                [[maybe_unused]] ssize_t ignored{ ::read(m_wakeFd, &count, sizeof(count)) };
+            }
+            else if (auto found{ m_connections.find(event.data.fd) }; found != m_connections.end())
+            {
+                if (event.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+                {
+                    receive(*found->second);
+                }
+
+                // A hung up socket fails the send, discarding what is unsent.
+                if (event.events & (EPOLLOUT | EPOLLHUP | EPOLLERR))
+                {
+                    send(*found->second);
+                }
+            }
+        }
+
+        collectOutput();
+    }
+
+    std::println("Closing {} sessions.", m_connections.size());
+    closeAll();
+
+    return true;
+}
+
+bool SessionServer::listen()
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    if (m_socket.native().size() >= sizeof(address.sun_path))
+    {
+        std::println("Socket path {} is too long.", m_socket.string());
+        return false;
+    }
+
+    std::memcpy(address.sun_path, m_socket.c_str(), m_socket.native().size());
+
+    // A socket left behind by an earlier server would block bind.
+    if (std::filesystem::is_socket(m_socket))
+    {
+        std::filesystem::remove(m_socket);
+    }
+
+    m_listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    m_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    m_wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (m_listenFd < 0 || m_epollFd < 0 || m_wakeFd < 0
+        || ::bind(m_listenFd, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) != 0
+        || ::listen(m_listenFd, SOMAXCONN) != 0)
+    {
+        std::println("Failed to listen on {}: {}", m_socket.string(), std::strerror(errno));
+        return false;
+    }
+
+    for (int fd : { m_listenFd, m_wakeFd })
+    {
+        epoll_event event{ .events = EPOLLIN, .data{ .fd = fd } };
+        ::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event);
+    }
+
+    return true;
+}
+
+void SessionServer::accept()
+{
+    while (true)
+    {
+        int fd{ ::accept4(m_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC) };
+
+        if (fd < 0)
+        {
+            return;  // EAGAIN once every pending connection is accepted.
+        }
+
+        auto connection{ std::make_unique<Connection>(fd, m_wakeFd) };
+        SessionConsole &console{ connection->console };
+
+        epoll_event event{ .events = EPOLLIN | EPOLLRDHUP, .data{ .fd = fd } };
+        ::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event);
+
+        connection->thread = std::jthread{ [this, &console]
+            {
+                try
+                {
+                    ConsoleScope scope{ console };
+                    m_session();
+                }
+                catch (ConsoleClosed const &)
+                {
+                    // The client went away mid session.
+                }
+
+                console.finish();
+            } };
+
+        m_connections.emplace(fd, std::move(connection));
+    }
+}
+
+void SessionServer::receive(Connection &connection)
+{
+    std::array<char, 4096> buffer;
+
+    while (connection.receiving)
+    {
+        ssize_t received{ ::recv(connection.fd, buffer.data(), buffer.size(), 0) };
+
+        if (received > 0)
+        {
+            if (!connection.console.deliver({ buffer.data(), static_cast<std::size_t>(received) }))
+            {
+                connection.unsent.append("\nInput line too long, closing the session.\n");
+                connection.receiving = false;
+                send(connection);
+                return;
+            }
+
+            continue;
+        }
+
+        if (received < 0 && (errno == EAGAIN || errno == EINTR))
+        {
+            return;
+        }
+
+        connection.receiving = false;
+        connection.console.close();
+        watch(connection);
+    }
+}
+
+void SessionServer::send(Connection &connection)
+{
+    while (!connection.unsent.empty())
+    {
+        ssize_t sent{ ::send(connection.fd, connection.unsent.data(), connection.unsent.size(), MSG_NOSIGNAL) };
+
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            if (errno != EAGAIN)
+            {
+                // The client is gone, so is anything still to be sent.
+                connection.unsent.clear();
+                connection.receiving = false;
+                connection.console.close();
+            }
+
+            break;
+        }
+
+        connection.unsent.erase(0, static_cast<std::size_t>(sent));
+    }
+
+    connection.console.drained(connection.unsent.size());
+    watch(connection);
+}
+
+void SessionServer::collectOutput()
+{
+    for (auto it{ m_connections.begin() }; it != m_connections.end();)
+    {
+        Connection &connection{ *it->second };
+
+        connection.unsent.append(connection.console.takeOutput());
+
+        if (!connection.unsent.empty())
+        {
+            send(connection);
+        }
+
+        if (connection.console.finished() && connection.unsent.empty())
+        {
+            ::close(connection.fd);
+            it = m_connections.erase(it);  // Joins the finished session thread.
+            continue;
+        }
+
+        ++it;
+    }
+}
+
+void SessionServer::watch(Connection &connection)
+{
+    epoll_event event{ .events = 0, .data{ .fd = connection.fd } };
+
+    if (connection.receiving)
+    {
+        event.events |= EPOLLIN | EPOLLRDHUP;
+    }
+
+    if (!connection.unsent.empty())
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    // EPOLLHUP is reported whatever the mask, so a connection with nothing
+    // left to do is removed rather than left to wake the loop until its
+    // session ends.
+    if (event.events == 0)
+    {
+        if (connection.watched)
+        {
+            ::epoll_ctl(m_epollFd, EPOLL_CTL_DEL, connection.fd, nullptr);
+            connection.watched = false;
+        }
+
+        return;
+    }
+
+    ::epoll_ctl(m_epollFd, connection.watched ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, connection.fd, &event);
+    connection.watched = true;
+}
+
+void SessionServer::closeAll()
+{
+    for (auto &[fd, connection] : m_connections)
+    {
+        connection->console.close();
+    }
+
+    for (auto &[fd, connection] : m_connections)
+    {
+        connection->thread.join();
+        ::close(fd);
+    }
+
+    m_connections.clear();
+}
@@ -0,0 +1,60 @@
+//******************************************************************************
+//File Name: sessionServer.hpp
+//Description: Serves interactive sessions over a Unix domain socket.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef SESSION_SERVER_HPP
+#define SESSION_SERVER_HPP
+
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+
+// Accepts connections on a Unix domain socket and runs `session` for each on
+// a thread of its own, with the connection installed as that thread's
+// console.  A single event loop thread does all socket I/O with epoll, so a
+// session thread only ever waits on its own console.
+//
+// Sessions run concurrently, so `session` must synchronise any data they
+// share, see SharedEmployeeDatabase.
+class SessionServer
+{
+public:
+    SessionServer(std::filesystem::path socket, std::function<void()> session);
+
+    // Closes every session still connected.
+    ~SessionServer();
+
+    SessionServer(SessionServer const &) = delete;
+    SessionServer &operator=(SessionServer const &) = delete;
+
+    // Serves connections until interrupted by SIGINT or SIGTERM.  Returns
+    // false if the socket could not be set up.
+    bool run();
+
+private:
+    struct Connection;
+
+    bool listen();
+    void accept();
+    void receive(Connection &connection);
+    void send(Connection &connection);
+    void collectOutput();
+    void watch(Connection &connection);
+    void closeAll();
+
+    std::filesystem::path m_socket;
+    std::function<void()> m_session;
+
+    int m_listenFd{ -1 };
+    int m_epollFd{ -1 };
+    int m_wakeFd{ -1 };
+
+    std::unordered_map<int, std::unique_ptr<Connection>> m_connections;
+};
+
+#endif
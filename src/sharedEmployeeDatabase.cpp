@@ -0,0 +1,177 @@
+//******************************************************************************
+//File Name: sharedEmployeeDatabase.cpp
+//Description: Implementation for SharedEmployeeDatabase object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "sharedEmployeeDatabase.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+// Change count of the master after the calling thread's last commit, so its
+// reads can wait to see their own writes.
+struct LastCommit
+{
+    SharedEmployeeDatabase const *database;
+    std::uint64_t changes;
+};
+
+thread_local LastCommit lastCommit{ nullptr, 0 };
+
+} // anonymous namespace
+
+SharedEmployeeDatabase::SharedEmployeeDatabase()
+: m_published{ std::make_shared<EmployeeDatabase>() }
+, m_publisher{ [this](std::stop_token stop) { run(stop); } }
+{}
+
+void SharedEmployeeDatabase::publish()
+{
+    // Changes made before now, e.g. replayed from the log, are in the first
+    // version already.
+    m_master.observeChanges([this](LogRecord const &record) { journal(record); });
+
+    publishNext();
+}
+
+std::shared_ptr<EmployeeDatabase const> SharedEmployeeDatabase::read() const
+{
+    if (lastCommit.database == this && m_publishedChanges.load(std::memory_order_acquire) < lastCommit.changes)
+    {
+        std::unique_lock lock{ m_publishMutex };
+        m_publishedChanged.wait(lock, [this]()
+            { return m_publishedChanges.load(std::memory_order_relaxed) >= lastCommit.changes; });
+    }
+
+    return m_published.load(std::memory_order_acquire);
+}
+
+void SharedEmployeeDatabase::committed()
+{
+    std::uint64_t const changes{ m_master.changeCount() };
+
+    lastCommit = { this, changes };
+
+    std::lock_guard lock{ m_publishMutex };
+
+    if (changes != m_committedChanges)
+    {
+        m_committedChanges = changes;
+        m_committedChanged.notify_one();
+    }
+}
+
+void SharedEmployeeDatabase::journal(LogRecord const &record)
+{
+    // The master counts the modification once this returns.
+    std::uint64_t const changes{ m_master.changeCount() + 1 };
+
+    std::lock_guard lock{ m_journalMutex };
+
+    m_journal.push_back({ .changes = changes, .operation = record.operation, .id = record.id,
+                          .newID = record.newID, .role = record.role, .name = std::string{ record.name },
+                          .password = std::string{ record.password } });
+}
+
+bool SharedEmployeeDatabase::catchUp(Replica &replica)
+{
+    std::vector<Change> missing;
+
+    {
+        std::lock_guard lock{ m_journalMutex };
+
+        auto first{ std::ranges::upper_bound(m_journal, replica.changes, {}, &Change::changes) };
+        missing.assign(first, m_journal.end());
+    }
+
+    for (Change const &change : missing)
+    {
+        if (!replica.database->apply(change.record()))
+        {
+            return false;
+        }
+
+        replica.changes = change.changes;
+    }
+
+    return true;
+}
+
+void SharedEmployeeDatabase::publishNext()
+{
+    Replica next{ std::exchange(m_standby, {}) };
+
+    // The standby is only shared with readers that have yet to let it go.
+    bool reusable{ next.database && next.database.use_count() == 1 };
+
+    if (reusable)
+    {
+        // Pairs with the release by the last reader to let go of it.
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+
+    if (!reusable || !catchUp(next))
+    {
+        // Copying the columns only briefly holds writers off; the indexes are
+        // built while they carry on.
+        Checkpoint checkpoint{ m_master.checkpoint() };
+
+        next = { std::make_shared<EmployeeDatabase>(), checkpoint.changes };
+        next.database->assign(std::move(checkpoint.employees));
+    }
+
+    // Once readers list in order, every version is published with its
+    // orderings, which applying changes keeps up to date, so no reader waits
+    // for them to be built.
+    if (m_current.database && m_current.database->isOrdered())
+    {
+        next.database->prepareOrderings();
+    }
+
+    m_published.store(next.database, std::memory_order_release);
+
+    {
+        std::lock_guard lock{ m_publishMutex };
+        m_publishedChanges.store(next.changes, std::memory_order_release);
+    }
+
+    m_publishedChanged.notify_all();
+
+    m_standby = std::exchange(m_current, std::move(next));
+
+    // Changes both replicas have are no longer needed.
+    std::uint64_t applied{ m_standby.database ? std::min(m_current.changes, m_standby.changes) : m_current.changes };
+
+    std::lock_guard lock{ m_journalMutex };
+
+    while (!m_journal.empty() && m_journal.front().changes <= applied)
+    {
+        m_journal.pop_front();
+    }
+}
+
+void SharedEmployeeDatabase::run(std::stop_token stop)
+{
+    while (true)
+    {
+        {
+            std::unique_lock lock{ m_publishMutex };
+
+            if (!m_committedChanged.wait(lock, stop, [this]()
+                    { return m_committedChanges > m_publishedChanges.load(std::memory_order_relaxed); }))
+            {
+                return;
+            }
+        }
+
+        publishNext();
+    }
+}
@@ -0,0 +1,148 @@
+//******************************************************************************
+//File Name: sharedEmployeeDatabase.hpp
+//Description: Employee database shared by concurrent sessions.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef SHARED_EMPLOYEE_DATABASE_HPP
+#define SHARED_EMPLOYEE_DATABASE_HPP
+
+#include "employeeDatabase.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+
+// Shares one employee database between any number of threads.  Readers are
+// handed the latest published version, an immutable copy they may use for as
+// long as they hold it, without ever blocking or being blocked by anyone.
+// Writers take turns committing to a master copy, and a publisher thread
+// brings the next version up to date with it, so a burst of commits is
+// published once.  A version is freed when the last reader holding it lets go.
+//
+// The publisher keeps two versions, in the manner of a left-right scheme:
+// the one readers are handed, and a standby that was last published before
+// it.  Commits are journaled as they are made, and the next version is the
+// standby with the journaled changes it lacks applied, in O(changes), along
+// with its orderings, which are built before it is published if the version
+// it replaces had them.  Keeping the standby costs one more copy of the
+// columns and indexes.  Only when readers still hold the standby, or a change
+// fails to apply, is the next version copied from the master and indexed
+// afresh, in O(n).
+class SharedEmployeeDatabase
+{
+public:
+    SharedEmployeeDatabase();
+
+    SharedEmployeeDatabase(SharedEmployeeDatabase const &) = delete;
+    SharedEmployeeDatabase &operator=(SharedEmployeeDatabase const &) = delete;
+
+    // The copy writers commit to.  Until the first `publish` it may be used
+    // freely, e.g. to load and replay changes; afterwards only through
+    // `write`, or the members EmployeeDatabase allows from other threads.
+    EmployeeDatabase &master() { return m_master; }
+
+    // Publishes the master as it is now, before readers are started.
+    void publish();
+
+    // Latest published version, including every commit made by the calling
+    // thread, whose publication it waits for if need be.
+    std::shared_ptr<EmployeeDatabase const> read() const;
+
+    // Calls `commit(master)` while holding the writers' turn and returns its
+    // result.  Other readers see its changes once the publisher catches up,
+    // so commits should not wait for input.
+    template<typename Commit>
+    decltype(auto) write(Commit &&commit)
+    {
+        std::lock_guard lock{ m_writeMutex };
+
+        if constexpr (std::is_void_v<std::invoke_result_t<Commit, EmployeeDatabase &>>)
+        {
+            commit(m_master);
+            committed();
+        }
+        else
+        {
+            auto result{ commit(m_master) };
+            committed();
+            return result;
+        }
+    }
+
+private:
+    // Wakes the publisher if the commit just made changed anything.
+    void committed();
+
+    // A version of the database, and the change count of the master it
+    // reflects.
+    struct Replica
+    {
+        std::shared_ptr<EmployeeDatabase> database;
+        std::uint64_t changes{};
+    };
+
+    // A committed modification, owning its strings, and the change count of
+    // the master once it was made.
+    struct Change
+    {
+        std::uint64_t changes;
+        LogOperation operation;
+        unsigned id;
+        unsigned newID;
+        Role role;
+        std::string name;
+        std::string password;
+
+        LogRecord record() const
+        {
+            return { .operation = operation, .id = id, .newID = newID, .role = role, .name = name,
+                     .password = password };
+        }
+    };
+
+    // Journals a modification of the master, see EmployeeDatabase::observeChanges.
+    void journal(LogRecord const &record);
+
+    // Applies the journaled changes `replica` lacks, returns false if any
+    // failed to apply.
+    bool catchUp(Replica &replica);
+
+    // Brings the standby, or else a copy of the master, up to date and makes
+    // it the one readers get.
+    void publishNext();
+
+    void run(std::stop_token stop);
+
+    EmployeeDatabase m_master;
+    std::mutex m_writeMutex;
+
+    std::atomic<std::shared_ptr<EmployeeDatabase const>> m_published;
+
+    // Only used by whichever thread publishes.
+    Replica m_current;              // The version readers get.
+    Replica m_standby;              // The version published before it.
+
+    // Changes not yet applied to both replicas, in the order made.
+    std::mutex m_journalMutex;
+    std::deque<Change> m_journal;
+
+    // Change counts of the master as last committed and as last published.
+    mutable std::mutex m_publishMutex;
+    mutable std::condition_variable_any m_publishedChanged;
+    std::condition_variable_any m_committedChanged;
+    std::uint64_t m_committedChanges{};
+    std::atomic<std::uint64_t> m_publishedChanges{};
+
+    std::jthread m_publisher;       // Declared last, so started last.
+};
+
+#endif
@@ -0,0 +1,265 @@
+//******************************************************************************
+//File Name: snapshot.cpp
+//Description: Implementation for binary snapshots of the employee store.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "snapshot.hpp"
+#include "employeeStore.hpp"
+#include "fileStamp.hpp"
+#include "mappedFile.hpp"
+#include "roles.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+// Anonymous namespace for helper functions.
+namespace
+{
+
+constexpr std::array<char, 8> snapshotMagic{ 'E', 'M', 'P', 'S', 'N', 'A', 'P', '\0' };
+constexpr std::uint32_t snapshotVersion{ 1 };
+constexpr std::uint32_t byteOrderMark{ 0x01020304 };
+
+struct SnapshotHeader
+{
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint64_t recordCount;
+    std::uint64_t heapSize;
+    std::uint64_t sourceSize;
+    std::int64_t sourceModified;
+    std::uint64_t checksum;         // Of everything following the header.
+};
+
+static_assert(sizeof(SnapshotHeader) % 8 == 0);
+
+constexpr std::size_t paddedSize(std::size_t bytes)
+{
+    return (bytes + 7) & ~std::size_t{ 7 };
+}
+
+// Word at a time checksum, `bytes` must be a multiple of 8 long.  Detects
+// truncation and corruption, it is not meant to resist tampering.
+std::uint64_t checksum(std::string_view bytes, std::uint64_t state)
+{
+    for (std::size_t i{}; i < bytes.size(); i += 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, bytes.data() + i, sizeof(word));
+        state = std::rotl(state ^ word, 29) * 0x9E3779B97F4A7C15;
+    }
+
+    return state;
+}
+
+constexpr std::uint64_t checksumSeed{ 0x736E617073686F74 };
+
+// Views the bytes of a column, padded with zeros to a multiple of 8.
+template<typename T>
+std::string_view columnBytes(std::vector<T> &column)
+{
+    static_assert(8 % sizeof(T) == 0);
+
+    std::size_t const bytes{ paddedSize(column.size() * sizeof(T)) };
+    column.resize(bytes / sizeof(T));
+
+    return { reinterpret_cast<char const *>(column.data()), bytes };
+}
+
+template<typename T>
+std::vector<T> readColumn(std::string_view bytes, std::size_t &offset, std::uint64_t count)
+{
+    std::vector<T> column(count);
+    std::memcpy(column.data(), bytes.data() + offset, count * sizeof(T));
+    offset += paddedSize(count * sizeof(T));
+
+    return column;
+}
+
+} // anonymous namespace
+
+bool writeSnapshot(EmployeeStore const &store,
+                   std::filesystem::path const &snapshot,
+                   std::filesystem::path const &source)
+{
+    std::vector<StringRef> names;
+    std::vector<StringRef> passwords;
+    std::vector<unsigned> ids;
+    std::vector<Role> roles;
+    std::string heap;
+    std::unordered_map<std::string_view, std::uint64_t> nameOffsets;
+
+    names.reserve(store.liveCount());
+    passwords.reserve(store.liveCount());
+    ids.reserve(store.liveCount());
+    roles.reserve(store.liveCount());
+
+    for (std::uint32_t position{}; position < store.size(); ++position)
+    {
+        if (!store.isLive(position))
+        {
+            continue;
+        }
+
+        // Names repeat often enough to be worth storing once each.
+        std::string_view name{ store.name(position) };
+        auto [nameOffset, inserted]{ nameOffsets.emplace(name, heap.size()) };
+
+        if (inserted)
+        {
+            heap.append(name);
+        }
+
+        names.emplace_back(nameOffset->second, name.size(), true);
+        passwords.emplace_back(heap.size(), store.password(position).size(), true);
+        heap.append(store.password(position));
+        ids.push_back(store.id(position));
+        roles.push_back(store.role(position));
+    }
+
+    std::uint64_t const recordCount{ ids.size() };
+    std::uint64_t const heapSize{ heap.size() };
+    heap.resize(paddedSize(heap.size()));
+
+    std::array<std::string_view, 5> sections{
+        columnBytes(names), columnBytes(passwords), columnBytes(ids), columnBytes(roles), heap
+    };
+
+    FileStamp stamp{ stampOf(source) };
+
+    SnapshotHeader header{
+        .magic = snapshotMagic,
+        .version = snapshotVersion,
+        .byteOrder = byteOrderMark,
+        .recordCount = recordCount,
+        .heapSize = heapSize,
+        .sourceSize = stamp.size,
+        .sourceModified = stamp.modified,
+        .checksum = checksumSeed,
+    };
+
+    for (std::string_view section : sections)
+    {
+        header.checksum = checksum(section, header.checksum);
+    }
+
+    std::filesystem::path temporary{ snapshot };
+    temporary += ".tmp";
+
+    {
+        std::ofstream file{ temporary, std::ios::binary | std::ios::trunc };
+
+        file.write(reinterpret_cast<char const *>(&header), sizeof(header));
+
+        for (std::string_view section : sections)
+        {
+            file.write(section.data(), static_cast<std::streamsize>(section.size()));
+        }
+
+        if (!file.flush())
+        {
+            std::println("Failed to write snapshot {}", temporary.string());
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, snapshot, error);
+
+    if (error)
+    {
+        std::println("Failed to replace snapshot {}: {}", snapshot.string(), error.message());
+        return false;
+    }
+
+    return true;
+}
+
+std::optional<EmployeeStore> loadSnapshot(std::filesystem::path const &snapshot,
+                                          std::filesystem::path const &source,
+                                          MappedFile &mapping)
+{
+    if (!std::filesystem::exists(snapshot))
+    {
+        return std::nullopt;
+    }
+
+    MappedFile mapped{ snapshot };
+    std::string_view bytes{ mapped.contents() };
+    SnapshotHeader header;
+
+    if (!mapped.isOpen() || bytes.size() < sizeof(header))
+    {
+        std::println("Snapshot {} is unreadable.", snapshot.string());
+        return std::nullopt;
+    }
+
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    if (header.magic != snapshotMagic || header.version != snapshotVersion || header.byteOrder != byteOrderMark)
+    {
+        std::println("Snapshot {} has an unsupported format.", snapshot.string());
+        return std::nullopt;
+    }
+
+    if (std::filesystem::exists(source))
+    {
+        FileStamp stamp{ stampOf(source) };
+
+        if (stamp != FileStamp{ header.sourceSize, header.sourceModified })
+        {
+            std::println("Snapshot {} is out of date with {}.", snapshot.string(), source.string());
+            return std::nullopt;
+        }
+    }
+
+    std::uint64_t const count{ header.recordCount };
+    std::uint64_t const bodySize{ 2 * paddedSize(count * sizeof(StringRef)) + paddedSize(count * sizeof(unsigned))
+                                  + paddedSize(count * sizeof(Role)) + paddedSize(header.heapSize) };
+
+    if (bytes.size() != sizeof(header) + bodySize
+        || checksum(bytes.substr(sizeof(header)), checksumSeed) != header.checksum)
+    {
+        std::println("Snapshot {} is corrupt.", snapshot.string());
+        return std::nullopt;
+    }
+
+    std::size_t offset{ sizeof(header) };
+
+    std::vector<StringRef> names{ readColumn<StringRef>(bytes, offset, count) };
+    std::vector<StringRef> passwords{ readColumn<StringRef>(bytes, offset, count) };
+    std::vector<unsigned> ids{ readColumn<unsigned>(bytes, offset, count) };
+    std::vector<Role> roles{ readColumn<Role>(bytes, offset, count) };
+
+    std::string_view heap{ bytes.substr(offset, header.heapSize) };
+
+    auto outOfHeap{ [&heap](StringRef ref) { return ref.offset() + ref.length() > heap.size(); } };
+    auto unknownRole{ [](Role role) { return static_cast<std::size_t>(role) >= roleCount; } };
+
+    if (std::ranges::any_of(names, outOfHeap) || std::ranges::any_of(passwords, outOfHeap)
+        || std::ranges::any_of(roles, unknownRole))
+    {
+        std::println("Snapshot {} is corrupt.", snapshot.string());
+        return std::nullopt;
+    }
+
+    mapping = std::move(mapped);
+
+    return EmployeeStore::fromColumns(std::move(ids), std::move(roles), std::move(names), std::move(passwords), heap);
+}
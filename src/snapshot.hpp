@@ -0,0 +1,41 @@
+//******************************************************************************
+//File Name: snapshot.hpp
+//Description: Versioned, checksummed binary snapshots of the employee store.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include "employeeStore.hpp"
+#include "mappedFile.hpp"
+
+#include <filesystem>
+#include <optional>
+
+
+// A snapshot holds the store's columns in their in-memory layout followed by a
+// string heap, so loading is a single mapping plus a bulk copy of each column
+// with no per-record parsing.  Names and passwords stay in the mapped heap.
+//
+// Layout, all sections padded to 8 bytes and in native byte order:
+//   header | names (StringRef) | passwords (StringRef) | ids (unsigned) | roles (Role) | heap
+//
+// The header records the size and modification time of the CSV the snapshot
+// was built from, so a snapshot is only used while that CSV is unchanged.
+
+// Writes the live records of `store` as a snapshot of the CSV at `source`.
+// The snapshot is written to a temporary file and renamed into place.
+bool writeSnapshot(EmployeeStore const &store,
+                   std::filesystem::path const &snapshot,
+                   std::filesystem::path const &source);
+
+// Maps the snapshot into `mapping` and builds a store borrowing its strings
+// from the mapping.  Returns nullopt, leaving `mapping` closed, when the
+// snapshot is missing, corrupt, from another version, or older than `source`.
+std::optional<EmployeeStore> loadSnapshot(std::filesystem::path const &snapshot,
+                                          std::filesystem::path const &source,
+                                          MappedFile &mapping);
+
+#endif
@@ -0,0 +1,117 @@
+//******************************************************************************
+//File Name: stringArena.cpp
+//Description: Implementation for StringArena object.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "stringArena.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+
+std::uint64_t StringArena::store(std::string_view text)
+{
+    if (text.empty())
+    {
+        return 0;
+    }
+
+    std::uint64_t const blockEnd{ m_blocks.size() * blockSize };
+
+    if (m_next + text.size() > blockEnd)
+    {
+        // Start a new block, abandoning the tail of the current one.
+        std::size_t blocks{ (text.size() + blockSize - 1) / blockSize };
+
+        m_blocks.push_back(std::make_shared_for_overwrite<char[]>(blocks * blockSize));
+        m_blocks.resize(m_blocks.size() + blocks - 1);
+        m_blockBytes += blocks * blockSize;
+        m_next = blockEnd;
+
+        if (blocks > 1)
+        {
+            // The block numbers after the first have no storage of their own,
+            // so the next string starts a fresh block.
+            std::memcpy(m_blocks[blockEnd / blockSize].get(), text.data(), text.size());
+            m_next = m_blocks.size() * blockSize;
+
+            return blockEnd;
+        }
+    }
+
+    std::uint64_t offset{ m_next };
+    std::memcpy(m_blocks[offset / blockSize].get() + offset % blockSize, text.data(), text.size());
+    m_next += text.size();
+
+    return offset;
+}
+
+std::uint64_t StringArena::intern(std::string_view text)
+{
+    if (auto found{ m_interned.find(text) }; found != m_interned.end())
+    {
+        return found->second;
+    }
+
+    std::uint64_t offset{ store(text) };
+    m_interned.emplace(view(offset, text.size()), offset);
+
+    return offset;
+}
+
+StringArena StringArena::share() const
+{
+    StringArena shared;
+
+    shared.m_blocks = m_blocks;
+    shared.m_blockBytes = m_blockBytes;
+
+    // Anything stored in the new arena starts a block of its own, so the
+    // blocks both arenas hold are only ever written by this one.
+    shared.m_next = m_blocks.size() * blockSize;
+
+    return shared;
+}
+
+std::uint64_t StringArena::absorb(StringArena &&other)
+{
+    if (other.m_blocks.empty())
+    {
+        return 0;
+    }
+
+    std::uint64_t const shift{ m_blocks.size() * blockSize };
+
+    std::ranges::move(other.m_blocks, std::back_inserter(m_blocks));
+    m_blockBytes += other.m_blockBytes;
+    m_next = shift + other.m_next;
+
+    // Interned views point into the moved blocks, so they remain valid.
+    for (auto const &[text, offset] : other.m_interned)
+    {
+        m_interned.emplace(text, offset + shift);
+    }
+
+    other.clear();
+    return shift;
+}
+
+void StringArena::clear()
+{
+    m_interned.clear();
+    m_blocks.clear();
+    m_blockBytes = 0;
+    m_next = 0;
+}
+
+std::size_t StringArena::bytesReserved() const
+{
+    // Approximate the intern table as one node plus one bucket per entry.
+    constexpr std::size_t internEntryBytes{ sizeof(std::string_view) + sizeof(std::uint64_t)
+                                            + 2 * sizeof(void *) + sizeof(std::size_t) };
+
+    return m_blockBytes + m_blocks.capacity() * sizeof(m_blocks[0]) + m_interned.size() * internEntryBytes;
+}
@@ -0,0 +1,73 @@
+//******************************************************************************
+//File Name: stringArena.hpp
+//Description: Block allocated, append only string storage with interning.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef STRING_ARENA_HPP
+#define STRING_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+// Stores strings back to back in large blocks, addressed by a 64 bit offset.
+// Blocks never move once allocated and are shared by every arena made from
+// this one with `share`, so views of stored strings stay valid until the last
+// arena holding the block is cleared or destroyed.  Nothing is freed
+// individually; replaced strings are reclaimed on reload.
+class StringArena
+{
+public:
+    static constexpr std::size_t blockSize{ std::size_t{ 1 } << 20 };
+
+    // Copies `text` into the arena, returns its offset.
+    std::uint64_t store(std::string_view text);
+
+    // As `store`, but returns the offset of an equal interned string if there
+    // is one, so repeated values (e.g. common names) are stored only once.
+    std::uint64_t intern(std::string_view text);
+
+    // String of `length` bytes at `offset`.
+    std::string_view view(std::uint64_t offset, std::size_t length) const
+    {
+        if (length == 0)
+        {
+            return {};
+        }
+
+        return { m_blocks[offset / blockSize].get() + offset % blockSize, length };
+    }
+
+    // Arena sharing every block of this one, in which every string stored so
+    // far has the same offset.  Strings stored so far may be viewed through
+    // the new arena from another thread while more are added to this one.
+    StringArena share() const;
+
+    // Moves every block of `other` into this arena, returns the amount that
+    // offsets into `other` must be shifted by to address the same strings here.
+    std::uint64_t absorb(StringArena &&other);
+
+    void clear();
+
+    // Bytes allocated for blocks, and for the intern table.
+    std::size_t bytesReserved() const;
+
+private:
+    // Start of the unused space, always within the last block.
+    std::uint64_t m_next{};
+
+    // A string larger than a block gets several consecutive block numbers, the
+    // first owning the whole allocation and the rest left empty.
+    std::vector<std::shared_ptr<char[]>> m_blocks;
+    std::size_t m_blockBytes{};
+
+    std::unordered_map<std::string_view, std::uint64_t> m_interned;
+};
+
+#endif
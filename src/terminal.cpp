@@ -0,0 +1,32 @@
+//******************************************************************************
+//File Name: terminal.cpp
+//Description: Implementation for in process terminal control.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#include "terminal.hpp"
+
+#include <unistd.h>
+
+#include <cstdio>
+
+
+bool outputIsTerminal()
+{
+    static bool const isTerminal{ ::isatty(STDOUT_FILENO) == 1 };
+    return isTerminal;
+}
+
+void clearTerminal()
+{
+    if (!outputIsTerminal())
+    {
+        return;
+    }
+
+    // Cursor home, clear screen, clear scrollback.  Written through stdio so
+    // it stays ordered with everything printed before it.
+    std::fputs("\x1b[H\x1b[2J\x1b[3J", stdout);
+    std::fflush(stdout);
+}
@@ -0,0 +1,20 @@
+//******************************************************************************
+//File Name: terminal.hpp
+//Description: In process terminal control for standard output.
+//Author: Austin Bachurski
+//Created: October 17, 2026
+//******************************************************************************
+
+#ifndef TERMINAL_HPP
+#define TERMINAL_HPP
+
+
+// Whether standard output is a terminal, determined once per process.
+bool outputIsTerminal();
+
+// Clears the terminal and its scrollback with ANSI escape sequences, the same
+// sequence `clear` emits, without starting a process.  Does nothing when
+// standard output is not a terminal.
+void clearTerminal();
+
+#endif